@@ -0,0 +1,864 @@
+package main
+
+import (
+    "bytes"
+    "flag"
+    "fmt"
+    "io/ioutil"
+    "sort"
+    "strings"
+    "unicode/utf8"
+
+    "dezip.org/dezip/tmlanguage"
+)
+
+// highlighting spends most of its time in oniguruma's regset search, which
+// tries every pattern in the current state at every position of the line.
+// most patterns can only start with a few bytes, though: in a c string, only
+// a backslash or a percent sign can start one.  running `dezip
+// compile-grammars` works out which bytes can start each pattern, for the
+// grammars of the most common languages, and writes a table for each state to
+// tmlanguage/dispatch.c.  at each position, the runtime only tries the
+// patterns which can start with the byte there, and skips positions where
+// none can.
+//
+// tables are found by a hash of the state's patterns (see tm.StateKey), so
+// grammars which have changed since dispatch.c was generated just go back to
+// the regset search.  rerun this after updating the grammars.
+const compileGrammarsCommand = "compile-grammars"
+
+// the languages tables are compiled for, unless others are given.  states of
+// other languages these include are compiled too.
+var compileGrammarsDefaultScopes = []string{
+    "source.c", "source.c++", "source.js", "source.ts", "source.python",
+    "source.java", "source.go", "source.shell", "text.html.basic", "source.json",
+}
+
+const compileGrammarsDefaultOutput = "tmlanguage/dispatch.c"
+
+// a table has a bit per pattern in a uint64_t.
+const compileDispatchPatternLimit = 64
+
+func compileGrammars(args []string) error {
+    flags := flag.NewFlagSet(compileGrammarsCommand, flag.ExitOnError)
+    output := flags.String("o", compileGrammarsDefaultOutput, "where to write the tables")
+    flags.Parse(args)
+    scopes := flags.Args()
+    if len(scopes) == 0 {
+        scopes = compileGrammarsDefaultScopes
+    }
+
+    paths := syntaxDefinitionPaths()
+    if len(paths) == 0 {
+        return fmt.Errorf("set DEZIP_SYNTAX to the grammars to compile")
+    }
+    var languages []*tm.Language
+    for _, p := range paths {
+        l, err := loadLanguage(p)
+        if err != nil {
+            return fmt.Errorf("%s: %v", p, err)
+        }
+        languages = append(languages, l)
+    }
+    wanted := map[string]bool{}
+    for _, scope := range scopes {
+        wanted[scope] = true
+    }
+
+    // the render workers use the reduced grammars too.
+    full, err := tm.DescribeStates(languages)
+    if err != nil {
+        return err
+    }
+    reduced, err := tm.DescribeStates(tm.ReduceLanguages(languages))
+    if err != nil {
+        return err
+    }
+
+    var tables []compiledDispatch
+    tableIndex := map[compiledDispatch]int{}
+    var entries []compiledDispatchEntry
+    seen := map[uint64]bool{}
+    states := 0
+    for _, s := range append(full, reduced...) {
+        if !wanted[s.Language.ScopeName] || len(s.Rules) == 0 {
+            continue
+        }
+        key := tm.StateKey(s.Rules)
+        if seen[key] {
+            continue
+        }
+        seen[key] = true
+        states++
+        table, ok := dispatchTable(s.Rules)
+        if !ok {
+            continue
+        }
+        index, found := tableIndex[table]
+        if !found {
+            index = len(tables)
+            tableIndex[table] = index
+            tables = append(tables, table)
+        }
+        entries = append(entries, compiledDispatchEntry{ key: key, table: index, language: s.Language.ScopeName, patterns: len(s.Rules) })
+    }
+    sort.Slice(entries, func (i, j int) bool { return entries[i].key < entries[j].key })
+
+    var b bytes.Buffer
+    writeCompiledDispatch(&b, scopes, tables, entries)
+    if err := ioutil.WriteFile(*output, b.Bytes(), 0644); err != nil {
+        return err
+    }
+    fmt.Printf("compiled %d tables for %d of %d states; wrote %s\n", len(tables), len(entries), states, *output)
+    return nil
+}
+
+// for each ascii byte, the patterns which can start with it.
+type compiledDispatch [0x80]uint64
+
+type compiledDispatchEntry struct {
+    key uint64
+    table int
+    language string
+    patterns int
+}
+
+// returns false if the state has too many patterns for a table, or a pattern
+// which could start anywhere.  such a pattern would be tried at every
+// position, which is slower than letting oniguruma look for it.
+func dispatchTable(rules []*tm.Rule) (compiledDispatch, bool) {
+    var table compiledDispatch
+    if len(rules) > compileDispatchPatternLimit {
+        return table, false
+    }
+    for i, rule := range rules {
+        pattern := rule.Match
+        if len(pattern) == 0 {
+            pattern = rule.Begin
+        }
+        first, ok := firstBytes(pattern)
+        if !ok {
+            return table, false
+        }
+        for c := 0; c < 0x80; c++ {
+            if first.has(byte(c)) {
+                table[c] |= 1 << uint(i)
+            }
+        }
+    }
+    for c := '0'; c <= 'z'; c++ {
+        if table[c] != 0 && (c <= '9' || c >= 'A' && c <= 'Z' || c >= 'a') {
+            return table, false
+        }
+    }
+    return table, true
+}
+
+func writeCompiledDispatch(b *bytes.Buffer, scopes []string, tables []compiledDispatch, entries []compiledDispatchEntry) {
+    fmt.Fprintf(b, "// dispatch.c\n")
+    fmt.Fprintf(b, "// generated by `dezip %s` for %s.  do not edit.\n\n", compileGrammarsCommand, strings.Join(scopes, ", "))
+    fmt.Fprintf(b, "#include \"tmlanguage.h\"\n")
+    for i, table := range tables {
+        fmt.Fprintf(b, "\nstatic const dispatch dispatch%d = {{\n", i)
+        for c := 0; c < 0x80; c += 4 {
+            fmt.Fprintf(b, "   ")
+            for j := c; j < c + 4; j++ {
+                fmt.Fprintf(b, " 0x%016x,", table[j])
+            }
+            fmt.Fprintf(b, " // %s\n", dispatchComment(byte(c)))
+        }
+        fmt.Fprintf(b, "}};\n")
+    }
+    if len(entries) == 0 {
+        fmt.Fprintf(b, "\nconst dispatch *compiledDispatch(uint64_t key)\n{\n    (void)key;\n    return 0;\n}\n")
+        return
+    }
+    fmt.Fprintf(b, "\n// sorted by key.\n")
+    fmt.Fprintf(b, "static const struct {\n    uint64_t key;\n    const dispatch *table;\n} compiledDispatches[] = {\n")
+    for _, e := range entries {
+        fmt.Fprintf(b, "    { 0x%016xULL, &dispatch%d }, // %s, %d patterns\n", e.key, e.table, e.language, e.patterns)
+    }
+    fmt.Fprintf(b, "};\n")
+    fmt.Fprintf(b, `
+const dispatch *compiledDispatch(uint64_t key)
+{
+    size_t lo = 0;
+    size_t hi = sizeof(compiledDispatches) / sizeof(compiledDispatches[0]);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (compiledDispatches[mid].key < key)
+            lo = mid + 1;
+        else if (compiledDispatches[mid].key > key)
+            hi = mid;
+        else
+            return compiledDispatches[mid].table;
+    }
+    return 0;
+}
+`)
+}
+
+// labels a row of four table entries, starting at c.
+func dispatchComment(c byte) string {
+    var labels []string
+    for i := c; i < c + 4; i++ {
+        if i > ' ' && i < 0x7f {
+            labels = append(labels, string(rune(i)))
+        } else {
+            labels = append(labels, fmt.Sprintf("%02x", i))
+        }
+    }
+    return strings.Join(labels, " ")
+}
+
+// -- first bytes
+
+type byteSet [4]uint64
+
+func (s *byteSet) add(c byte) {
+    s[c / 64] |= 1 << (c % 64)
+}
+
+func (s *byteSet) addRange(lo byte, hi byte) {
+    for c := int(lo); c <= int(hi); c++ {
+        s.add(byte(c))
+    }
+}
+
+func (s *byteSet) union(other byteSet) {
+    for i := range s {
+        s[i] |= other[i]
+    }
+}
+
+func (s byteSet) has(c byte) bool {
+    return s[c / 64] & (1 << (c % 64)) != 0
+}
+
+func allBytes() byteSet {
+    return byteSet{ ^uint64(0), ^uint64(0), ^uint64(0), ^uint64(0) }
+}
+
+// the bytes which can start a non-ascii character.
+func highBytes() byteSet {
+    var s byteSet
+    s.addRange(0x80, 0xff)
+    return s
+}
+
+// ascii letters also fold to non-ascii characters (like k to the kelvin sign)
+// when matching case-insensitively, so this adds every non-ascii byte too.
+func (s *byteSet) foldCase() {
+    for c := 'a'; c <= 'z'; c++ {
+        if s.has(byte(c)) || s.has(byte(c - 'a' + 'A')) {
+            s.add(byte(c))
+            s.add(byte(c - 'a' + 'A'))
+            s.union(highBytes())
+        }
+    }
+}
+
+// returns the bytes which can start a match of regex.  returns false if
+// regex can match the empty string anywhere, or uses syntax this doesn't
+// understand.  the set can have extra bytes, but never misses one.
+//
+// "nullable" below means an atom can match without looking at the byte at
+// its position.  an empty match which needs a particular next byte, like
+// (?=//), isn't nullable: its set is the bytes it looks ahead for.
+func firstBytes(regex string) (byteSet, bool) {
+    p := &firstByteParser{ s: regex }
+    set, nullable := p.alternatives()
+    if p.failed || p.i < len(p.s) || nullable {
+        return byteSet{}, false
+    }
+    return set, true
+}
+
+type firstByteParser struct {
+    s string
+    i int
+    ignoreCase bool
+    extended bool
+    failed bool
+}
+
+func (p *firstByteParser) fail() (byteSet, bool) {
+    p.failed = true
+    p.i = len(p.s)
+    return allBytes(), true
+}
+
+// parses alternatives up to the end of the enclosing group, consuming the
+// closing parenthesis.
+func (p *firstByteParser) alternatives() (byteSet, bool) {
+    ignoreCase, extended := p.ignoreCase, p.extended
+    var set byteSet
+    nullable := false
+    for {
+        s, n := p.sequence()
+        set.union(s)
+        nullable = nullable || n
+        if p.i < len(p.s) && p.s[p.i] == '|' {
+            p.i++
+            continue
+        }
+        if p.i < len(p.s) && p.s[p.i] == ')' {
+            p.i++
+        }
+        break
+    }
+    // options set inside a group only last until its end.
+    p.ignoreCase, p.extended = ignoreCase, extended
+    return set, nullable
+}
+
+func (p *firstByteParser) sequence() (byteSet, bool) {
+    var set byteSet
+    nullable := true
+    for {
+        p.skipExtended()
+        if p.i >= len(p.s) || p.s[p.i] == '|' || p.s[p.i] == ')' {
+            return set, nullable
+        }
+        s, n, quantifiable := p.atom()
+        if p.failed {
+            return allBytes(), true
+        }
+        if quantifiable {
+            for {
+                p.skipExtended()
+                min, ok := p.quantifier()
+                if !ok {
+                    break
+                }
+                if min == 0 {
+                    n = true
+                }
+            }
+        }
+        if nullable {
+            set.union(s)
+            nullable = n
+        }
+    }
+}
+
+func (p *firstByteParser) skipExtended() {
+    for p.extended && p.i < len(p.s) {
+        switch c := p.s[p.i]; {
+        case c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v':
+            p.i++
+        case c == '#':
+            for p.i < len(p.s) && p.s[p.i] != '\n' {
+                p.i++
+            }
+        default:
+            return
+        }
+    }
+}
+
+// returns the minimum repetitions of the quantifier at p.i, if there is one.
+func (p *firstByteParser) quantifier() (int, bool) {
+    if p.i >= len(p.s) {
+        return 0, false
+    }
+    min := 0
+    switch p.s[p.i] {
+    case '*', '?':
+        p.i++
+    case '+':
+        p.i++
+        min = 1
+    case '{':
+        // {n}, {n,}, {,m}, or {n,m}.  anything else is a literal brace.
+        j := p.i + 1
+        n, digits := 0, 0
+        for j < len(p.s) && p.s[j] >= '0' && p.s[j] <= '9' {
+            n = n * 10 + int(p.s[j] - '0')
+            j++
+            digits++
+        }
+        maxDigits := 0
+        if j < len(p.s) && p.s[j] == ',' {
+            j++
+            for j < len(p.s) && p.s[j] >= '0' && p.s[j] <= '9' {
+                j++
+                maxDigits++
+            }
+        }
+        if j >= len(p.s) || p.s[j] != '}' || digits + maxDigits == 0 {
+            return 0, false
+        }
+        p.i = j + 1
+        min = n
+    default:
+        return 0, false
+    }
+    // lazy and possessive forms.
+    if p.i < len(p.s) && (p.s[p.i] == '?' || p.s[p.i] == '+') {
+        p.i++
+    }
+    return min, true
+}
+
+// returns the bytes the atom at p.i can start with, whether it can match
+// the empty string, and whether a quantifier can follow it.
+func (p *firstByteParser) atom() (byteSet, bool, bool) {
+    c := p.s[p.i]
+    p.i++
+    switch c {
+    case '.':
+        return allBytes(), false, true
+    case '^':
+        return byteSet{}, true, true
+    case '$':
+        // matches before a newline, or at the end of the line, where the
+        // runtime always searches.
+        var set byteSet
+        set.add('\n')
+        return set, false, true
+    case '[':
+        set, ok := p.class()
+        if !ok {
+            s, n := p.fail()
+            return s, n, false
+        }
+        return set, false, true
+    case '(':
+        return p.group()
+    case '\\':
+        return p.escape()
+    case '*', '+', '?':
+        s, n := p.fail()
+        return s, n, false
+    }
+    p.i--
+    return p.literal(p.character()), false, true
+}
+
+// reads a literal character, which may take several bytes.
+func (p *firstByteParser) character() rune {
+    r, size := utf8.DecodeRuneInString(p.s[p.i:])
+    p.i += size
+    return r
+}
+
+func (p *firstByteParser) literal(r rune) byteSet {
+    var set byteSet
+    if r < utf8.RuneSelf {
+        set.add(byte(r))
+        if p.ignoreCase {
+            set.foldCase()
+        }
+        return set
+    }
+    if p.ignoreCase {
+        // non-ascii characters can fold to ascii ones (like the sharp s to
+        // ss).
+        return allBytes()
+    }
+    // escapes like \xff stand for single bytes, not characters, so don't
+    // bother narrowing this down to the first byte of the encoding.
+    return highBytes()
+}
+
+func (p *firstByteParser) group() (byteSet, bool, bool) {
+    if p.i >= len(p.s) || p.s[p.i] != '?' {
+        set, nullable := p.alternatives()
+        return set, nullable, true
+    }
+    p.i++
+    if p.i >= len(p.s) {
+        s, n := p.fail()
+        return s, n, false
+    }
+    switch c := p.s[p.i]; {
+    case c == '#':
+        for p.i < len(p.s) && p.s[p.i] != ')' {
+            p.i++
+        }
+        p.i++
+        return byteSet{}, true, false
+    case c == ':' || c == '>':
+        p.i++
+        set, nullable := p.alternatives()
+        return set, nullable, true
+    case c == '=':
+        // a lookahead doesn't consume anything, but the match still starts
+        // with what it looks for.
+        p.i++
+        set, nullable := p.alternatives()
+        return set, nullable, true
+    case c == '!':
+        p.i++
+        p.alternatives()
+        return byteSet{}, true, true
+    case c == '<' && p.i + 1 < len(p.s) && (p.s[p.i+1] == '=' || p.s[p.i+1] == '!'):
+        p.i += 2
+        p.alternatives()
+        return byteSet{}, true, true
+    case c == '<' || c == '\'':
+        closing := byte('>')
+        if c == '\'' {
+            closing = '\''
+        }
+        end := strings.IndexByte(p.s[p.i+1:], closing)
+        if end < 0 {
+            s, n := p.fail()
+            return s, n, false
+        }
+        p.i += end + 2
+        set, nullable := p.alternatives()
+        return set, nullable, true
+    }
+    // option settings like (?i) or (?x-i:...).
+    ignoreCase, extended := p.ignoreCase, p.extended
+    on := true
+    for p.i < len(p.s) {
+        switch p.s[p.i] {
+        case 'i':
+            ignoreCase = on
+        case 'x':
+            extended = on
+        case 'm':
+            // dot matches newlines.  dot is every byte anyway.
+        case '-':
+            on = false
+        case ')':
+            // applies to the rest of the enclosing group.
+            p.i++
+            p.ignoreCase, p.extended = ignoreCase, extended
+            return byteSet{}, true, false
+        case ':':
+            p.i++
+            outerIgnoreCase, outerExtended := p.ignoreCase, p.extended
+            p.ignoreCase, p.extended = ignoreCase, extended
+            set, nullable := p.alternatives()
+            p.ignoreCase, p.extended = outerIgnoreCase, outerExtended
+            return set, nullable, true
+        default:
+            s, n := p.fail()
+            return s, n, false
+        }
+        p.i++
+    }
+    s, n := p.fail()
+    return s, n, false
+}
+
+func (p *firstByteParser) escape() (byteSet, bool, bool) {
+    if p.i >= len(p.s) {
+        s, n := p.fail()
+        return s, n, false
+    }
+    c := p.s[p.i]
+    p.i++
+    switch c {
+    case 'b', 'B', 'A', 'z', 'Z', 'G':
+        return byteSet{}, true, true
+    case '1', '2', '3', '4', '5', '6', '7', '8', '9':
+        // a backreference, which can be empty.
+        for p.i < len(p.s) && p.s[p.i] >= '0' && p.s[p.i] <= '9' {
+            p.i++
+        }
+        return allBytes(), true, true
+    case 'k', 'g':
+        // a backreference or subexpression call by name.
+        p.skipName()
+        return allBytes(), true, true
+    case 'K':
+        return byteSet{}, true, false
+    case 'd', 'w', 's', 'h', 'D', 'W', 'S', 'H':
+        set, _ := escapeClass(c)
+        return set, false, true
+    case 'R':
+        var set byteSet
+        for _, c := range "\n\v\f\r" {
+            set.add(byte(c))
+        }
+        set.union(highBytes())
+        return set, false, true
+    case 'p', 'P', 'X', 'N', 'O':
+        if c == 'p' || c == 'P' {
+            p.skipBraces()
+        }
+        return allBytes(), false, true
+    }
+    r, ok := p.escapedCharacter(c)
+    if !ok {
+        s, n := p.fail()
+        return s, n, false
+    }
+    return p.literal(r), false, true
+}
+
+// skips a group name like <name> or 'name'.
+func (p *firstByteParser) skipName() {
+    if p.i >= len(p.s) || (p.s[p.i] != '<' && p.s[p.i] != '\'') {
+        return
+    }
+    closing := byte('>')
+    if p.s[p.i] == '\'' {
+        closing = '\''
+    }
+    if end := strings.IndexByte(p.s[p.i+1:], closing); end >= 0 {
+        p.i += end + 2
+    }
+}
+
+func (p *firstByteParser) skipBraces() {
+    if p.i < len(p.s) && p.s[p.i] == '{' {
+        if end := strings.IndexByte(p.s[p.i:], '}'); end >= 0 {
+            p.i += end + 1
+            return
+        }
+    }
+    if p.i < len(p.s) {
+        p.i++
+    }
+}
+
+// the ascii members of \d, \w, \s, and \h, and their negations.  all of them
+// can also match non-ascii characters.  the ascii members are exact.
+func escapeClass(c byte) (byteSet, bool) {
+    var set byteSet
+    switch c | 0x20 {
+    case 'd':
+        set.addRange('0', '9')
+    case 'w':
+        set.addRange('0', '9')
+        set.addRange('a', 'z')
+        set.addRange('A', 'Z')
+        set.add('_')
+    case 's':
+        for _, c := range "\t\n\v\f\r " {
+            set.add(byte(c))
+        }
+    case 'h':
+        set.addRange('0', '9')
+        set.addRange('a', 'f')
+        set.addRange('A', 'F')
+    default:
+        return set, false
+    }
+    if c >= 'A' && c <= 'Z' {
+        for i := 0; i < 2; i++ {
+            set[i] = ^set[i]
+        }
+    }
+    set.union(highBytes())
+    return set, true
+}
+
+// the character for an escape like \n, \x41, or \., after the backslash and
+// c have been read.  returns false for escapes this doesn't understand,
+// including backreferences.
+func (p *firstByteParser) escapedCharacter(c byte) (rune, bool) {
+    switch c {
+    case 't':
+        return '\t', true
+    case 'n':
+        return '\n', true
+    case 'r':
+        return '\r', true
+    case 'f':
+        return '\f', true
+    case 'v':
+        return '\v', true
+    case 'a':
+        return 7, true
+    case 'e':
+        return 0x1b, true
+    case 'x':
+        if p.i < len(p.s) && p.s[p.i] == '{' {
+            return p.number(16, '}')
+        }
+        return p.digits(16, 2)
+    case 'u':
+        return p.digits(16, 4)
+    case 'o':
+        if p.i < len(p.s) && p.s[p.i] == '{' {
+            return p.number(8, '}')
+        }
+        return 0, false
+    case '0':
+        r, _ := p.digits(8, 2)
+        return r, true
+    }
+    if c >= 0x80 || c >= '0' && c <= '9' || c >= 'a' && c <= 'z' || c >= 'A' && c <= 'Z' {
+        return 0, false
+    }
+    return rune(c), true
+}
+
+// reads up to n digits in base.
+func (p *firstByteParser) digits(base int, n int) (rune, bool) {
+    r, count := rune(0), 0
+    for count < n && p.i < len(p.s) {
+        d := digitValue(p.s[p.i])
+        if d < 0 || d >= base {
+            break
+        }
+        r = r * rune(base) + rune(d)
+        p.i++
+        count++
+    }
+    return r, count > 0
+}
+
+// reads {digits}.
+func (p *firstByteParser) number(base int, closing byte) (rune, bool) {
+    p.i++
+    r, ok := p.digits(base, 8)
+    if !ok || p.i >= len(p.s) || p.s[p.i] != closing {
+        return 0, false
+    }
+    p.i++
+    return r, true
+}
+
+func digitValue(c byte) int {
+    switch {
+    case c >= '0' && c <= '9':
+        return int(c - '0')
+    case c >= 'a' && c <= 'f':
+        return int(c - 'a') + 10
+    case c >= 'A' && c <= 'F':
+        return int(c - 'A') + 10
+    }
+    return -1
+}
+
+// parses a character class after its opening bracket, returning the bytes
+// its characters can start with.  returns false if it can't be sure.
+func (p *firstByteParser) class() (byteSet, bool) {
+    negated := false
+    if p.i < len(p.s) && p.s[p.i] == '^' {
+        negated = true
+        p.i++
+    }
+    var set byteSet
+    // whether the ascii members of set are exactly the ones in the class,
+    // which a negated class needs.
+    exact := true
+    first := true
+    for {
+        if p.i >= len(p.s) {
+            return byteSet{}, false
+        }
+        c := p.s[p.i]
+        if c == ']' && !first {
+            p.i++
+            break
+        }
+        first = false
+        if c == '[' && p.i + 1 < len(p.s) && p.s[p.i+1] == ':' {
+            end := strings.Index(p.s[p.i:], ":]")
+            if end < 0 {
+                return byteSet{}, false
+            }
+            // posix brackets like [:alpha:].  unicode characters count too.
+            p.i += end + 2
+            set = allBytes()
+            exact = false
+            continue
+        }
+        if c == '[' {
+            p.i++
+            nested, ok := p.class()
+            if !ok {
+                return byteSet{}, false
+            }
+            set.union(nested)
+            exact = false
+            continue
+        }
+        if c == '&' && p.i + 1 < len(p.s) && p.s[p.i+1] == '&' {
+            // an intersection, which is smaller than the union of its sides.
+            p.i += 2
+            exact = false
+            continue
+        }
+        if p.extended && negated && (c == ' ' || c == '\t' || c == '\n' || c == '#') {
+            // it's not clear whether these count in extended mode.
+            p.i++
+            set.add(c)
+            exact = false
+            continue
+        }
+        if c == '\\' && p.i + 1 < len(p.s) && (p.s[p.i+1] == 'p' || p.s[p.i+1] == 'P') {
+            // unicode properties like \p{L}.
+            p.i += 2
+            p.skipBraces()
+            set = allBytes()
+            exact = false
+            continue
+        }
+        lo, loSet, ok := p.classCharacter()
+        if !ok {
+            return byteSet{}, false
+        }
+        if loSet != nil {
+            set.union(*loSet)
+            continue
+        }
+        if p.i + 1 < len(p.s) && p.s[p.i] == '-' && p.s[p.i+1] != ']' {
+            p.i++
+            hi, hiSet, ok := p.classCharacter()
+            if !ok || hiSet != nil || hi < lo {
+                return byteSet{}, false
+            }
+            for r := lo; r <= hi && r < utf8.RuneSelf; r++ {
+                set.add(byte(r))
+            }
+            if hi >= utf8.RuneSelf {
+                set.union(highBytes())
+            }
+            continue
+        }
+        if lo < utf8.RuneSelf {
+            set.add(byte(lo))
+        } else {
+            set.union(highBytes())
+        }
+    }
+    if p.ignoreCase {
+        set.foldCase()
+    }
+    if negated {
+        if !exact {
+            // it still matches one character, which could start with any
+            // byte.
+            return allBytes(), true
+        }
+        for i := 0; i < 2; i++ {
+            set[i] = ^set[i]
+        }
+        set.union(highBytes())
+    }
+    return set, true
+}
+
+// reads a character in a class, or a class escape like \w (returned as a
+// set).
+func (p *firstByteParser) classCharacter() (rune, *byteSet, bool) {
+    c := p.s[p.i]
+    if c != '\\' {
+        return p.character(), nil, true
+    }
+    p.i++
+    if p.i >= len(p.s) {
+        return 0, nil, false
+    }
+    c = p.s[p.i]
+    p.i++
+    if set, ok := escapeClass(c); ok {
+        return 0, &set, true
+    }
+    if c == 'b' {
+        return 8, nil, true
+    }
+    r, ok := p.escapedCharacter(c)
+    return r, nil, ok
+}
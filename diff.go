@@ -0,0 +1,541 @@
+package main
+
+import (
+    "bytes"
+    "encoding/json"
+    "fmt"
+    "io/ioutil"
+    "log"
+    "os"
+    "path"
+    "runtime/debug"
+    "sort"
+    "strings"
+    "time"
+)
+
+// how many unchanged lines should be shown around each change?
+const diffContextLines = 3
+
+// files needing more than this many inserted or deleted lines to turn one
+// version into the other aren't diffed (the work grows with the square of the
+// number of edits).
+const diffEditLimit = 2000
+
+// the maximum number of lines shown when comparing two archives.
+const diffLineLimit = 99999
+
+// the files in an archive, as recorded in the zip central directory.  this is
+// written to the archive metadata so finished archives can be compared without
+// re-reading any file contents.
+type archiveManifestEntry struct {
+    Name string
+    CRC32 uint32
+    Size uint64
+    Lines int
+}
+
+func newArchiveManifest(entries []*archiveDirectoryEntry) []archiveManifestEntry {
+    manifest := make([]archiveManifestEntry, 0, len(entries))
+    for _, entry := range entries {
+        manifest = append(manifest, archiveManifestEntry{
+            Name: entry.file.Name,
+            CRC32: entry.file.CRC32,
+            Size: entry.file.UncompressedSize64,
+            Lines: entry.lines,
+        })
+    }
+    return manifest
+}
+
+// returns the manifest and initial directory of an archive which has finished
+// downloading.
+func (c *cache) archiveManifest(ar *archive) ([]archiveManifestEntry, string, error) {
+    ar.mutex.Lock()
+    state := ar.state
+    initialDirectory := ar.initialDirectory
+    if state == archiveStateRendering {
+        // the zip directory is still in memory.
+        manifest := newArchiveManifest(ar.filesToRender)
+        ar.mutex.Unlock()
+        return manifest, initialDirectory, nil
+    }
+    reason := ar.failureReason
+    metadataPath := c.archiveMetadataPath(ar.path)
+    ar.mutex.Unlock()
+    if state == archiveStateFailed {
+        return nil, "", reason
+    } else if state != archiveStateFinished {
+        return nil, "", fmt.Errorf("the archive hasn't finished downloading")
+    }
+    file, err := os.Open(metadataPath)
+    if err != nil {
+        return nil, "", err
+    }
+    defer file.Close()
+    metadata, err := readMetadata(file)
+    if err != nil {
+        return nil, "", err
+    }
+    if len(metadata.Manifest) == 0 {
+        return nil, "", fmt.Errorf("this archive was cached by an older version of dezip.  remove it and load it again to compare it with other archives.")
+    }
+    var manifest []archiveManifestEntry
+    if err := json.Unmarshal(metadata.Manifest, &manifest); err != nil {
+        return nil, "", err
+    }
+    return manifest, initialDirectory, nil
+}
+
+type diffStatus int
+const (
+    diffStatusChanged diffStatus = iota
+    diffStatusAdded
+    diffStatusRemoved
+)
+
+type diffResult struct {
+    // the path of the file relative to the initial directory of each archive.
+    file string
+    status diffStatus
+    // paths to the rendered versions of the file in each archive.
+    oldPath string
+    newPath string
+
+    // a block of changed lines.  line numbers are zero for lines which only
+    // appear in the other version.
+    oldLineNumbers []int
+    newLineNumbers []int
+    html string
+    // explains why the file has no blocks of lines, e.g. if it's a binary file.
+    note string
+
+    // set on the last result.
+    summary *diffSummary
+
+    err error
+}
+
+type diffSummary struct {
+    changed int
+    added int
+    removed int
+    unchanged int
+}
+
+// compare the files in ar with the files in the archive at otherURL.  files
+// with the same checksum and size in both manifests are skipped without
+// looking at their contents.  changed files are compared line by line using
+// their renders, so the results keep their syntax highlighting.
+func (c *cache) diff(ar *archive, otherURL string, results chan diffResult) {
+    defer close(results)
+    defer func () {
+        if r := recover(); r != nil {
+            log.Print("recovered in diff: ", r, "\n", string(debug.Stack()))
+            results <- diffResult{ err: fmt.Errorf("panic during diff: %v\n%v", r, string(debug.Stack())) }
+        }
+    }()
+    c.mutex.RLock()
+    other := c.archivesByURL[otherURL]
+    c.mutex.RUnlock()
+    if other == nil {
+        if owner := c.peers.owner(otherURL); owner != nil {
+            results <- diffResult{ err: fmt.Errorf("%s is cached by another dezip node (%s), and archives on different nodes can't be compared.", otherURL, owner.url) }
+            return
+        }
+        results <- diffResult{ err: fmt.Errorf("%s isn't in the cache.  load it first, then try again.", otherURL) }
+        return
+    }
+    timeout := time.After(searchTimeoutSeconds * time.Second)
+    other.mutex.Lock()
+    downloaded := other.downloaded
+    if other.state == archiveStateFailed {
+        downloaded = closedChannel
+    }
+    other.mutex.Unlock()
+    select {
+    case <-downloaded:
+    case <-timeout:
+        results <- diffResult{ err: fmt.Errorf("%s is still downloading.  reload the page to keep waiting for it.", otherURL) }
+        return
+    }
+    oldManifest, oldDirectory, err := c.archiveManifest(ar)
+    if err != nil {
+        results <- diffResult{ err: err }
+        return
+    }
+    newManifest, newDirectory, err := c.archiveManifest(other)
+    if err != nil {
+        results <- diffResult{ err: fmt.Errorf("%s: %v", otherURL, err) }
+        return
+    }
+
+    // match up files by their paths relative to the initial directory, so
+    // e.g. project-1.0/README lines up with project-1.1/README.
+    oldFiles := manifestByRelativePath(oldManifest, oldDirectory)
+    newFiles := manifestByRelativePath(newManifest, newDirectory)
+    var names []string
+    for name := range oldFiles {
+        names = append(names, name)
+    }
+    for name := range newFiles {
+        if _, ok := oldFiles[name]; !ok {
+            names = append(names, name)
+        }
+    }
+    sort.Strings(names)
+
+    var summary diffSummary
+    linesShown := 0
+    for _, name := range names {
+        oldFile, newFile := oldFiles[name], newFiles[name]
+        result := diffResult{ file: name }
+        if oldFile != nil {
+            result.oldPath = path.Join(ar.path, oldFile.Name)
+        }
+        if newFile != nil {
+            result.newPath = path.Join(other.path, newFile.Name)
+        }
+        if newFile == nil {
+            summary.removed++
+            result.status = diffStatusRemoved
+            results <- result
+            continue
+        } else if oldFile == nil {
+            summary.added++
+            result.status = diffStatusAdded
+            results <- result
+            continue
+        } else if oldFile.CRC32 == newFile.CRC32 && oldFile.Size == newFile.Size {
+            summary.unchanged++
+            continue
+        }
+        summary.changed++
+        if linesShown >= diffLineLimit {
+            result.note = "not compared (too many changes in this archive)"
+            results <- result
+            continue
+        }
+        if oldFile.Lines < 0 || newFile.Lines < 0 {
+            result.note = "binary files differ"
+            results <- result
+            continue
+        }
+        oldLines, err := c.renderedLines(ar, oldFile.Name, timeout)
+        if err != nil {
+            results <- diffResult{ err: err }
+            return
+        }
+        newLines, err := c.renderedLines(other, newFile.Name, timeout)
+        if err != nil {
+            results <- diffResult{ err: err }
+            return
+        }
+        ops, ok := diffLines(oldLines, newLines, diffEditLimit)
+        if !ok {
+            result.note = fmt.Sprintf("too many changes to show (more than %d lines)", diffEditLimit)
+            results <- result
+            continue
+        }
+        sent := false
+        writeDiffHunks(ops, oldLines, newLines, func (hunk diffResult) {
+            hunk.file = result.file
+            hunk.oldPath = result.oldPath
+            hunk.newPath = result.newPath
+            linesShown += len(hunk.oldLineNumbers)
+            results <- hunk
+            sent = true
+        })
+        if !sent {
+            // the checksums differ, but the rendered lines don't (e.g. only
+            // line endings changed).
+            result.note = "no differences in the text (line endings may have changed)"
+            results <- result
+        }
+    }
+    results <- diffResult{ summary: &summary }
+}
+
+func manifestByRelativePath(manifest []archiveManifestEntry, initialDirectory string) map[string]*archiveManifestEntry {
+    files := make(map[string]*archiveManifestEntry, len(manifest))
+    prefix := ""
+    if initialDirectory != "" {
+        prefix = initialDirectory + "/"
+    }
+    for i := range manifest {
+        files[strings.TrimPrefix(manifest[i].Name, prefix)] = &manifest[i]
+    }
+    return files
+}
+
+// wait for a file to be rendered, then split the render into lines of html.
+func (c *cache) renderedLines(ar *archive, name string, timeout <-chan time.Time) ([][]byte, error) {
+    ar.mutex.Lock()
+    rendered := ar.requestRender(name)
+    ar.mutex.Unlock()
+    select {
+    case <-timeout:
+        return nil, fmt.Errorf("stopped comparing after %d seconds.  this includes waiting for files to be rendered, so reloading the page may help.", searchTimeoutSeconds)
+    case <-rendered:
+    }
+    // prefer the "text" version of markdown files.
+    buf, err := ioutil.ReadFile(path.Join(c.textPath, ar.path, name))
+    if err != nil {
+        buf, err = ioutil.ReadFile(path.Join(c.rootPath, ar.path, name))
+    }
+    if err != nil {
+        return nil, fmt.Errorf("unable to open file “%s”", name)
+    }
+    // the same assumptions as matchLines() apply: the searchable region is
+    // between the search markers, and elements spanning lines are tracked
+    // with a tagStack, so each line stands on its own.
+    start := bytes.Index(buf, []byte(beginSearchMarker))
+    end := bytes.LastIndex(buf, []byte(endSearchMarker))
+    if start < 0 || end < start {
+        // empty files don't have any lines.
+        return nil, nil
+    }
+    buf = buf[start+len(beginSearchMarker):end]
+    var lines [][]byte
+    var stack tagStack
+    for len(buf) > 0 {
+        i := bytes.IndexByte(buf, '\n') + 1
+        if i == 0 {
+            i = len(buf)
+        }
+        line := buf[:i]
+        if begin := stack.begin(); begin != nil || bytes.IndexByte(line, '<') >= 0 {
+            stack.scan(line)
+            line = wrapLine(begin, line, stack.end())
+        }
+        lines = append(lines, line)
+        buf = buf[i:]
+    }
+    return lines, nil
+}
+
+// -- line diff
+
+type diffOp byte
+const (
+    diffKeep diffOp = iota
+    diffDelete
+    diffInsert
+)
+
+// find a shortest sequence of deletions and insertions which turns a into b.
+// lines are compared with their html tags removed, since the same text can be
+// highlighted differently depending on what comes before it.  returns false if
+// more than limit deletions and insertions are needed.
+func diffLines(a [][]byte, b [][]byte, limit int) ([]diffOp, bool) {
+    // number each distinct line so comparisons are cheap.
+    ids := make(map[string]int32)
+    number := func (lines [][]byte) []int32 {
+        numbered := make([]int32, len(lines))
+        var text []byte
+        for i, line := range lines {
+            text = appendWithoutTags(text[:0], line)
+            id, ok := ids[string(text)]
+            if !ok {
+                id = int32(len(ids))
+                ids[string(text)] = id
+            }
+            numbered[i] = id
+        }
+        return numbered
+    }
+    x, y := number(a), number(b)
+
+    // lines at the beginning and end are usually unchanged.
+    prefix := 0
+    for prefix < len(x) && prefix < len(y) && x[prefix] == y[prefix] {
+        prefix++
+    }
+    suffix := 0
+    for suffix < len(x) - prefix && suffix < len(y) - prefix && x[len(x)-1-suffix] == y[len(y)-1-suffix] {
+        suffix++
+    }
+    middle, ok := myersDiff(x[prefix:len(x)-suffix], y[prefix:len(y)-suffix], limit)
+    if !ok {
+        return nil, false
+    }
+    ops := make([]diffOp, 0, prefix + len(middle) + suffix)
+    for i := 0; i < prefix; i++ {
+        ops = append(ops, diffKeep)
+    }
+    ops = append(ops, middle...)
+    for i := 0; i < suffix; i++ {
+        ops = append(ops, diffKeep)
+    }
+    return ops, true
+}
+
+func appendWithoutTags(text []byte, line []byte) []byte {
+    inTag := false
+    for _, c := range line {
+        if c == '<' {
+            inTag = true
+        } else if c == '>' {
+            inTag = false
+        } else if !inTag {
+            text = append(text, c)
+        }
+    }
+    return text
+}
+
+// the greedy algorithm from eugene myers' "an O(ND) difference algorithm and
+// its variations".  v[k] is the furthest x reached along diagonal k = x - y;
+// a copy of v is saved for each number of edits d so the path can be traced
+// back afterwards.
+func myersDiff(a []int32, b []int32, limit int) ([]diffOp, bool) {
+    n, m := len(a), len(b)
+    max := n + m
+    if max > limit {
+        max = limit
+    }
+    offset := max + 1
+    v := make([]int32, 2 * max + 3)
+    var trace [][]int32
+    for d := 0; d <= max; d++ {
+        saved := make([]int32, 2 * d + 1)
+        copy(saved, v[offset-d:offset+d+1])
+        trace = append(trace, saved)
+        for k := -d; k <= d; k += 2 {
+            var x int
+            if k == -d || (k != d && v[offset+k-1] < v[offset+k+1]) {
+                x = int(v[offset+k+1])
+            } else {
+                x = int(v[offset+k-1]) + 1
+            }
+            y := x - k
+            for x < n && y < m && a[x] == b[y] {
+                x++
+                y++
+            }
+            v[offset+k] = int32(x)
+            if x >= n && y >= m {
+                return myersBacktrack(trace, n, m), true
+            }
+        }
+    }
+    return nil, false
+}
+
+func myersBacktrack(trace [][]int32, n int, m int) []diffOp {
+    var ops []diffOp
+    x, y := n, m
+    for d := len(trace) - 1; d > 0; d-- {
+        // trace[d] holds v from before step d, indexed by k + d.
+        v := trace[d]
+        k := x - y
+        var previousK int
+        if k == -d || (k != d && v[k-1+d] < v[k+1+d]) {
+            previousK = k + 1
+        } else {
+            previousK = k - 1
+        }
+        previousX := int(v[previousK+d])
+        previousY := previousX - previousK
+        for x > previousX && y > previousY {
+            ops = append(ops, diffKeep)
+            x--
+            y--
+        }
+        if x == previousX {
+            ops = append(ops, diffInsert)
+        } else {
+            ops = append(ops, diffDelete)
+        }
+        x, y = previousX, previousY
+    }
+    for x > 0 && y > 0 {
+        ops = append(ops, diffKeep)
+        x--
+        y--
+    }
+    for i, j := 0, len(ops) - 1; i < j; i, j = i + 1, j - 1 {
+        ops[i], ops[j] = ops[j], ops[i]
+    }
+    return ops
+}
+
+// group the changes into blocks with diffContextLines of unchanged lines on
+// either side.  blocks whose context would overlap are merged.
+func writeDiffHunks(ops []diffOp, a [][]byte, b [][]byte, visit func(diffResult)) {
+    i := 0
+    x, y := 0, 0
+    for i < len(ops) {
+        if ops[i] == diffKeep {
+            i++
+            x++
+            y++
+            continue
+        }
+        start := i - diffContextLines
+        if start < 0 {
+            start = 0
+        }
+        x -= i - start
+        y -= i - start
+        end := i
+        for end < len(ops) {
+            if ops[end] != diffKeep {
+                end++
+                continue
+            }
+            run := end
+            for run < len(ops) && ops[run] == diffKeep {
+                run++
+            }
+            if run == len(ops) || run - end > 2 * diffContextLines {
+                if run - end < diffContextLines {
+                    end = run
+                } else {
+                    end += diffContextLines
+                }
+                break
+            }
+            end = run
+        }
+        var hunk diffResult
+        var buf bytes.Buffer
+        for _, op := range ops[start:end] {
+            switch op {
+            case diffKeep:
+                hunk.oldLineNumbers = append(hunk.oldLineNumbers, x + 1)
+                hunk.newLineNumbers = append(hunk.newLineNumbers, y + 1)
+                writeDiffLine(&buf, b[y], "")
+                x++
+                y++
+            case diffDelete:
+                hunk.oldLineNumbers = append(hunk.oldLineNumbers, x + 1)
+                hunk.newLineNumbers = append(hunk.newLineNumbers, 0)
+                writeDiffLine(&buf, a[x], "diff-removed")
+                x++
+            case diffInsert:
+                hunk.oldLineNumbers = append(hunk.oldLineNumbers, 0)
+                hunk.newLineNumbers = append(hunk.newLineNumbers, y + 1)
+                writeDiffLine(&buf, b[y], "diff-added")
+                y++
+            }
+        }
+        hunk.html = buf.String()
+        visit(hunk)
+        i = end
+    }
+}
+
+func writeDiffLine(buf *bytes.Buffer, line []byte, class string) {
+    line = bytes.TrimSuffix(line, []byte("\n"))
+    if class == "" {
+        buf.Write(line)
+    } else {
+        buf.WriteString("<span class='")
+        buf.WriteString(class)
+        buf.WriteString("'>")
+        buf.Write(line)
+        buf.WriteString("</span>")
+    }
+    buf.WriteByte('\n')
+}
@@ -0,0 +1,212 @@
+package main
+
+import (
+    "fmt"
+    "sort"
+    "strings"
+    "time"
+)
+
+// the directory structure of an archive, built up during analysis.  nodes are
+// stored in a single slice and refer to each other by index, so adding a file
+// costs one lookup per path component rather than a map (and a joined path
+// string) per directory.
+type directoryTree struct {
+    nodes []directoryNode
+
+    // maps (parent, name) pairs to child nodes while the tree is being built.
+    // discarded by finish().
+    childIndex map[directoryChildKey]int32
+
+    // after finish(), the children of each directory are stored contiguously
+    // in this slice -- subdirectories first, then files, each sorted by name.
+    children []int32
+
+    numberOfDirectories int
+}
+
+type directoryChildKey struct {
+    parent int32
+    name string
+}
+
+type directoryNode struct {
+    // the last component of the path.  this shares memory with the name of
+    // the zip.File it came from.
+    name string
+    parent int32
+
+    // nil for directories.
+    entry *archiveDirectoryEntry
+    isDirectory bool
+
+    // for files, these are copied from the entry.  for directories, they're
+    // the most recent modification date and the total number of lines of
+    // everything within (computed by finish()).
+    modified time.Time
+    lines int
+
+    // the number of direct children.
+    numberOfChildren int32
+
+    // set by finish().
+    childrenOffset int32
+    numberOfSubdirectories int32
+    numberOfFiles int32
+    // the node index of the readme file to show on the directory page, or
+    // noDirectoryNode.
+    readme int32
+}
+
+// the root directory is always the first node.
+const rootDirectoryNode = 0
+const noDirectoryNode = -1
+
+func newDirectoryTree() *directoryTree {
+    t := &directoryTree{ childIndex: make(map[directoryChildKey]int32) }
+    t.nodes = append(t.nodes, directoryNode{ parent: noDirectoryNode, isDirectory: true, readme: noDirectoryNode })
+    t.numberOfDirectories = 1
+    return t
+}
+
+func (t *directoryTree) child(parent int32, name string) int32 {
+    if id, ok := t.childIndex[directoryChildKey{ parent, name }]; ok {
+        return id
+    }
+    id := int32(len(t.nodes))
+    t.nodes = append(t.nodes, directoryNode{ name: name, parent: parent, readme: noDirectoryNode })
+    t.childIndex[directoryChildKey{ parent, name }] = id
+    t.nodes[parent].numberOfChildren++
+    return id
+}
+
+func (t *directoryTree) add(file *archiveDirectoryEntry, components []string) error {
+    dir := int32(rootDirectoryNode)
+    for index, component := range components {
+        // check for empty path components.
+        isIntermediateDirectory := index != len(components) - 1
+        if len(component) == 0 {
+            if index == 0 {
+                return fmt.Errorf("directoryTree.add(): absolute path %v not allowed", strings.Join(components, "/"))
+            } else if isIntermediateDirectory {
+                return fmt.Errorf("directoryTree.add(): empty directory not allowed in path %v", strings.Join(components, "/"))
+            } else {
+                // if the last component is empty, this is just a directory
+                // name.  keep track of its modification date.
+                if file.modified.After(t.nodes[dir].modified) {
+                    t.nodes[dir].modified = file.modified
+                }
+                break
+            }
+        }
+        id := t.child(dir, component)
+        node := &t.nodes[id]
+        if isIntermediateDirectory {
+            if !node.isDirectory {
+                node.isDirectory = true
+                node.entry = nil
+                t.numberOfDirectories++
+            }
+        } else {
+            // this is the entry for the file itself.
+            node.entry = file
+            node.modified = file.modified
+            node.lines = file.lines
+        }
+        if t.nodes[dir].numberOfChildren > entriesPerDirectoryLimit {
+            return fmt.Errorf("directoryTree.add(): directory '%s' has more than %d entries", t.path(dir), entriesPerDirectoryLimit)
+        }
+        dir = id
+    }
+    return nil
+}
+
+// finish() sorts the children of each directory, picks readme files, and
+// computes modification dates and line counts for directories.  the tree can't
+// be added to afterwards.
+func (t *directoryTree) finish() {
+    t.childIndex = nil
+    // parents are always created before their children, so walking the nodes
+    // backwards visits each directory after everything inside it.
+    for id := len(t.nodes) - 1; id > rootDirectoryNode; id-- {
+        node := &t.nodes[id]
+        parent := &t.nodes[node.parent]
+        if node.modified.After(parent.modified) {
+            parent.modified = node.modified
+        }
+        // files whose lines weren't counted have -1, which is summed in
+        // like any other count, as it always has been.
+        parent.lines += node.lines
+    }
+    // lay out the children of each directory.
+    offset := int32(0)
+    for id := range t.nodes {
+        t.nodes[id].childrenOffset = offset
+        offset += t.nodes[id].numberOfChildren
+    }
+    t.children = make([]int32, offset)
+    filled := make([]int32, len(t.nodes))
+    for id := rootDirectoryNode + 1; id < len(t.nodes); id++ {
+        parent := &t.nodes[t.nodes[id].parent]
+        t.children[parent.childrenOffset + filled[t.nodes[id].parent]] = int32(id)
+        filled[t.nodes[id].parent]++
+        if t.nodes[id].isDirectory {
+            parent.numberOfSubdirectories++
+        } else {
+            parent.numberOfFiles++
+            if t.nodes[id].lines > 0 {
+                readme := ""
+                if parent.readme != noDirectoryNode {
+                    readme = t.nodes[parent.readme].name
+                }
+                if useAsReadme(readme, t.nodes[id].name) {
+                    parent.readme = int32(id)
+                }
+            }
+        }
+    }
+    for id := range t.nodes {
+        c := t.childrenOf(int32(id))
+        sort.Slice(c, func (i, j int) bool {
+            a, b := &t.nodes[c[i]], &t.nodes[c[j]]
+            if a.isDirectory != b.isDirectory {
+                return a.isDirectory
+            }
+            return a.name < b.name
+        })
+    }
+}
+
+func (t *directoryTree) childrenOf(id int32) []int32 {
+    node := &t.nodes[id]
+    return t.children[node.childrenOffset:node.childrenOffset + node.numberOfChildren]
+}
+
+func (t *directoryTree) subdirectories(id int32) []int32 {
+    return t.childrenOf(id)[:t.nodes[id].numberOfSubdirectories]
+}
+
+func (t *directoryTree) files(id int32) []int32 {
+    return t.childrenOf(id)[t.nodes[id].numberOfSubdirectories:]
+}
+
+// the path of the node relative to the root of the archive.
+func (t *directoryTree) path(id int32) string {
+    if id == rootDirectoryNode {
+        return ""
+    }
+    length := -1
+    for i := id; i != rootDirectoryNode; i = t.nodes[i].parent {
+        length += len(t.nodes[i].name) + 1
+    }
+    b := make([]byte, length)
+    for i := id; i != rootDirectoryNode; i = t.nodes[i].parent {
+        length -= len(t.nodes[i].name)
+        copy(b[length:], t.nodes[i].name)
+        if length > 0 {
+            length--
+            b[length] = '/'
+        }
+    }
+    return string(b)
+}
@@ -0,0 +1,265 @@
+package main
+
+import (
+    "archive/zip"
+    "fmt"
+    "hash/crc32"
+    "io"
+    "io/ioutil"
+    "math"
+    "os"
+    "runtime"
+
+    "dezip.org/dezip/inflate"
+)
+
+// entries in real zip archives are usually deflated, and every stage that
+// reads a file -- analysis, rendering text and markdown, embedding readmes,
+// reading symlink targets -- would inflate it all over again.  analysis reads
+// every file anyway, so it also writes the archive out a second time, with
+// the files later stages will read stored uncompressed.  everything else is
+// copied over still compressed.  once analysis is done, the copy replaces the
+// downloaded zip file, and reading a file from it is just a read.
+type zipExtraction struct {
+    f *os.File
+    w *zip.Writer
+    // the entries written so far, in the order they were written, so they can
+    // be pointed at the copy.
+    entries []*archiveDirectoryEntry
+}
+
+// returns nil if no files in the archive are compressed (like the zip files
+// converted from tarballs), since there's nothing to gain by copying it.
+func newZipExtraction(files []*zip.File) (*zipExtraction, error) {
+    compressed := false
+    for _, file := range files {
+        if file.Method != zip.Store {
+            compressed = true
+            break
+        }
+    }
+    if !compressed {
+        return nil, nil
+    }
+    f, err := ioutil.TempFile("", "dezip.*.zip")
+    if err != nil {
+        return nil, err
+    }
+    return &zipExtraction{ f: f, w: zip.NewWriter(f) }, nil
+}
+
+// writes entry to the copy uncompressed, using contents, which were read from
+// it during analysis.
+func (x *zipExtraction) store(entry *archiveDirectoryEntry, contents []byte) error {
+    if entry.file.Method == zip.Store {
+        return x.copy(entry)
+    }
+    header := entry.file.FileHeader
+    header.Method = zip.Store
+    // the extra fields describe the compressed entry; zip.Writer adds its own.
+    header.Extra = nil
+    w, err := x.w.CreateHeader(&header)
+    if err != nil {
+        return err
+    }
+    if _, err := w.Write(contents); err != nil {
+        return err
+    }
+    x.entries = append(x.entries, entry)
+    return nil
+}
+
+// copies entry to the copy as it is, without inflating it.
+func (x *zipExtraction) copy(entry *archiveDirectoryEntry) error {
+    r, err := entry.file.OpenRaw()
+    if err != nil {
+        return err
+    }
+    header := entry.file.FileHeader
+    w, err := x.w.CreateRaw(&header)
+    if err != nil {
+        return err
+    }
+    if _, err := io.Copy(w, r); err != nil {
+        return err
+    }
+    x.entries = append(x.entries, entry)
+    return nil
+}
+
+// finishes writing the copy and opens it.  x.entries[i] is rc.File[i].
+func (x *zipExtraction) finish() (*zip.ReadCloser, error) {
+    if err := x.w.Close(); err != nil {
+        return nil, err
+    }
+    if err := x.f.Close(); err != nil {
+        return nil, err
+    }
+    return zip.OpenReader(x.f.Name())
+}
+
+// removes the copy, if it hasn't replaced the downloaded zip file.
+func (x *zipExtraction) discard() {
+    x.f.Close()
+    os.Remove(x.f.Name())
+}
+
+// -- reading entries
+
+// analysis works through files in archive order, but inflating them is the
+// slow part, so upcoming files are read and inflated ahead of time on every
+// core.  how far ahead is limited by zipReadAheadLimit and the memory budget.
+const zipReadAheadLimit = 64
+
+type zipRead struct {
+    file *zip.File
+    contents []byte
+    err error
+    reserved int64
+    done chan struct{}
+}
+
+type zipReadAhead struct {
+    reads chan *zipRead
+    stop chan struct{}
+    // the read most recently returned by next(), which holds its memory until
+    // the following call.
+    current *zipRead
+}
+
+// starts reading the files for which wanted returns true.  archiveSize is the
+// size of the zip file they're in.
+func readZipFilesAhead(files []*zip.File, archiveSize int64, wanted func (*zip.File) bool) *zipReadAhead {
+    a := &zipReadAhead{
+        reads: make(chan *zipRead, zipReadAheadLimit),
+        stop: make(chan struct{}),
+    }
+    go func () {
+        defer close(a.reads)
+        inflating := make(chan struct{}, runtime.NumCPU())
+        for _, file := range files {
+            if !wanted(file) {
+                continue
+            }
+            select {
+            case <-a.stop:
+                return
+            default:
+            }
+            // wait until there's memory available to hold the contents.
+            r := &zipRead{
+                file: file,
+                reserved: memory.reserve(zipReadMemory(file, archiveSize)),
+                done: make(chan struct{}),
+            }
+            select {
+            case a.reads <- r:
+            case <-a.stop:
+                memory.release(r.reserved)
+                return
+            }
+            inflating <- struct{}{}
+            go func () {
+                defer func () {
+                    if p := recover(); p != nil {
+                        r.contents, r.err = nil, fmt.Errorf("%s: %v", r.file.Name, p)
+                    }
+                    close(r.done)
+                    <-inflating
+                }()
+                r.contents, r.err = readZipFile(r.file, archiveSize)
+            }()
+        }
+    }()
+    return a
+}
+
+// returns the contents of file, which must be one of the wanted files.
+// wanted files before it which weren't asked for are thrown away.  the
+// contents are only valid until the next call.
+func (a *zipReadAhead) next(file *zip.File) ([]byte, error) {
+    a.release()
+    for r := range a.reads {
+        <-r.done
+        if r.file == file {
+            a.current = r
+            return r.contents, r.err
+        }
+        memory.release(r.reserved)
+    }
+    return nil, fmt.Errorf("%s wasn't read ahead", file.Name)
+}
+
+func (a *zipReadAhead) release() {
+    if a.current != nil {
+        memory.release(a.current.reserved)
+        a.current = nil
+    }
+}
+
+// stops reading ahead, releasing the memory held by files that were read but
+// never used.
+func (a *zipReadAhead) close() {
+    a.release()
+    close(a.stop)
+    for r := range a.reads {
+        <-r.done
+        memory.release(r.reserved)
+    }
+}
+
+// the most n bytes can take up deflated: stored blocks add 5 bytes per 16k or
+// so, plus some slack for the block headers of tiny files.
+func deflateBound(n uint64) uint64 {
+    return n + n / 16000 * 5 + 1024
+}
+
+// deflated files are inflated natively if their sizes are believable -- the
+// sizes come from the archive, and buffers are allocated to match.
+func inflatesNatively(file *zip.File, archiveSize int64) bool {
+    return file.Method == zip.Deflate &&
+        file.UncompressedSize64 <= textFileSizeLimit &&
+        file.CompressedSize64 <= uint64(archiveSize) &&
+        file.CompressedSize64 <= deflateBound(file.UncompressedSize64)
+}
+
+// the memory readZipFile needs for file.
+func zipReadMemory(file *zip.File, archiveSize int64) int64 {
+    if inflatesNatively(file, archiveSize) {
+        // both sizes are bounded, so this can't overflow.
+        return int64(file.UncompressedSize64 + file.CompressedSize64)
+    }
+    if file.UncompressedSize64 > math.MaxInt64 {
+        return math.MaxInt64
+    }
+    return int64(file.UncompressedSize64)
+}
+
+// reads the whole of file.  deflated files with a known size are inflated
+// natively, straight into a buffer of that size.
+func readZipFile(file *zip.File, archiveSize int64) ([]byte, error) {
+    if !inflatesNatively(file, archiveSize) {
+        rc, err := file.Open()
+        if err != nil {
+            return nil, err
+        }
+        defer rc.Close()
+        return ioutil.ReadAll(rc)
+    }
+    r, err := file.OpenRaw()
+    if err != nil {
+        return nil, err
+    }
+    compressed := make([]byte, file.CompressedSize64)
+    if _, err := io.ReadFull(r, compressed); err != nil {
+        return nil, err
+    }
+    contents := make([]byte, file.UncompressedSize64)
+    if err := inflate.Inflate(contents, compressed); err != nil {
+        return nil, fmt.Errorf("%s: %v", file.Name, err)
+    }
+    if file.CRC32 != 0 && crc32.ChecksumIEEE(contents) != file.CRC32 {
+        return nil, zip.ErrChecksum
+    }
+    return contents, nil
+}
@@ -0,0 +1,123 @@
+package main
+
+import (
+    "os"
+    "path"
+    "sync"
+    "syscall"
+)
+
+// writing out an archive's directory pages and reclaiming an archive each
+// issue one small filesystem operation per file -- mkdir, create, write,
+// close, unlink -- and archives can have hundreds of thousands of files.
+// issued one at a time, these operations spend most of their time waiting on
+// the filesystem, so they're submitted to a shared pool instead, where many
+// of them can be in flight at once.
+//
+// go has no io_uring support, but a goroutine blocked in a syscall gets its
+// own thread, so the pool is effectively a thread pool sized by
+// fileOperationConcurrency.
+const fileOperationConcurrency = 32
+
+var fileOperationSlots = make(chan struct{}, fileOperationConcurrency)
+
+// a group of operations submitted to the pool, which can be waited on
+// together.  operations must not submit more operations themselves, or they
+// could end up waiting on slots held by operations waiting on them.
+type fileBatch struct {
+    wg sync.WaitGroup
+    mutex sync.Mutex
+    err error
+}
+
+// runs op on the pool, waiting for a free slot first if the pool is busy.
+// this keeps the submitter from getting too far ahead of the filesystem.
+func (b *fileBatch) submit(op func() error) {
+    fileOperationSlots <- struct{}{}
+    b.wg.Add(1)
+    go func () {
+        defer func () {
+            <-fileOperationSlots
+            b.wg.Done()
+        }()
+        if err := op(); err != nil {
+            b.mutex.Lock()
+            if b.err == nil {
+                b.err = err
+            }
+            b.mutex.Unlock()
+        }
+    }()
+}
+
+// waits for every operation submitted so far, returning the first error.
+func (b *fileBatch) wait() error {
+    b.wg.Wait()
+    b.mutex.Lock()
+    defer b.mutex.Unlock()
+    return b.err
+}
+
+// writes contents to filename, creating its directory if needed.
+func writeFileCreatingDirectory(filename string, contents []byte) error {
+    if err := os.MkdirAll(path.Dir(filename), 0755); err != nil {
+        return err
+    }
+    f, err := os.Create(filename)
+    if err != nil {
+        return err
+    }
+    if _, err := f.Write(contents); err != nil {
+        f.Close()
+        return err
+    }
+    return f.Close()
+}
+
+// removes directory and everything in it, like os.RemoveAll.  each level of
+// the tree is listed, then its files are unlinked through the pool.  unlinking
+// a directory fails, which is how subdirectories are found without an lstat
+// per file; they make up the next level.  the directories themselves are
+// removed last, deepest level first.
+func removeTree(directory string) {
+    var levels [][]string
+    level := []string{ directory }
+    for len(level) > 0 {
+        levels = append(levels, level)
+        var b fileBatch
+        var mutex sync.Mutex
+        var next []string
+        for _, dir := range level {
+            f, err := os.Open(dir)
+            if err != nil {
+                continue
+            }
+            names, _ := f.Readdirnames(-1)
+            f.Close()
+            for _, name := range names {
+                filename := path.Join(dir, name)
+                b.submit(func () error {
+                    err := syscall.Unlink(filename)
+                    if err == syscall.EISDIR || err == syscall.EPERM {
+                        mutex.Lock()
+                        next = append(next, filename)
+                        mutex.Unlock()
+                    }
+                    return nil
+                })
+            }
+        }
+        b.wait()
+        level = next
+    }
+    for i := len(levels) - 1; i >= 0; i-- {
+        var b fileBatch
+        for _, dir := range levels[i] {
+            dir := dir
+            b.submit(func () error {
+                return syscall.Rmdir(dir)
+            })
+        }
+        b.wait()
+    }
+}
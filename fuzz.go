@@ -0,0 +1,620 @@
+package main
+
+import (
+    "crypto/sha1"
+    "encoding/hex"
+    "errors"
+    "flag"
+    "fmt"
+    "io/ioutil"
+    "log"
+    "math/rand"
+    "path"
+    "runtime/debug"
+    "sort"
+    "time"
+
+    "dezip.org/dezip/tmlanguage"
+)
+
+// running `dezip fuzz-grammars corpus-directory [scope...]` hunts for inputs
+// which are slow to highlight.  each grammar (or just the named ones) is fed
+// inputs built from the literals in its own patterns, mutated over and over.
+// inputs that reach new scopes are kept to mutate further, as are inputs that
+// are slower per byte than what they were mutated from.  inputs that end up
+// fuzzSlowFactor times slower than usual are shrunk to the smallest version
+// that's still slow and saved to corpus-directory/scope/, where
+// `dezip fuzz-grammars -replay corpus-directory` checks them again after
+// grammars or the highlighter change.
+//
+// oniguruma doesn't report how many steps a search took, so time per byte is
+// the measure of slowness.  inputs are highlighted by a render worker (see
+// worker.go), so one that backtracks forever or crashes the highlighter can be
+// killed, and is recorded as slow.
+const fuzzGrammarsCommand = "fuzz-grammars"
+
+// inputs this many times slower per byte than the grammar's typical input
+// are saved.  typical is the median cost of inputs generated the same way as
+// the starting inputs, measured fresh each run, so the corpus is checked
+// against the speed of the machine it's replayed on.
+const fuzzSlowFactor = 10
+
+// how long each grammar is fuzzed, unless -time says otherwise.
+const fuzzTimePerGrammar = 10 * time.Second
+
+// how long to spend shrinking each slow input.
+const fuzzMinimizeTime = 5 * time.Second
+
+const fuzzInputLimit = 4096
+
+// costs are computed as if inputs were at least this long, so the fixed
+// cost of starting a render doesn't make tiny inputs look slow.
+const fuzzCostMinimumLength = 256
+
+// a single input taking longer than this (or crashing the worker) is saved
+// right away instead of being mutated further.  the worker is killed at the
+// limit, so the input's cost is taken to be the limit.
+const fuzzRunTimeLimit = 1 * time.Second
+
+const fuzzCorpusLimit = 512
+
+// at most this many of the slowest inputs are saved for each grammar.
+const fuzzSlowInputLimit = 16
+
+type fuzzInput struct {
+    data []byte
+    cost int64
+}
+
+type grammarFuzzer struct {
+    worker *renderWorker
+    lang *tm.Language
+    random *rand.Rand
+    tokens []string
+    corpus []*fuzzInput
+    // scope transitions seen so far, like "source.c>string.quoted.double.c".
+    features map[string]bool
+    runs int
+    // inputs costing more than this (in nanoseconds per byte) are slow.
+    slowCost int64
+    slow []*fuzzInput
+}
+
+func fuzzGrammars(args []string) error {
+    flags := flag.NewFlagSet(fuzzGrammarsCommand, flag.ExitOnError)
+    duration := flags.Duration("time", fuzzTimePerGrammar, "how long to fuzz each grammar")
+    replay := flags.Bool("replay", false, "check the inputs already in the corpus instead of fuzzing")
+    flags.Parse(args)
+    if flags.NArg() < 1 {
+        return fmt.Errorf("usage: dezip %s [-time duration] [-replay] corpus-directory [scope...]", fuzzGrammarsCommand)
+    }
+    corpusDirectory := flags.Arg(0)
+
+    languages, languagesByScope, err := loadFuzzGrammars()
+    if err != nil {
+        return err
+    }
+    worker := &renderWorker{}
+    defer worker.stop()
+
+    if *replay {
+        return replayFuzzCorpus(worker, languagesByScope, corpusDirectory)
+    }
+    targets := languages
+    if flags.NArg() > 1 {
+        targets = nil
+        for _, scope := range flags.Args()[1:] {
+            l := languagesByScope[scope]
+            if l == nil {
+                return fmt.Errorf("no grammar has the scope %s", scope)
+            }
+            targets = append(targets, l)
+        }
+    }
+    for _, l := range targets {
+        f := newGrammarFuzzer(worker, l)
+        f.fuzz(*duration)
+        fmt.Printf("%s: %d runs, %d inputs, %d scope transitions, %d slow (over %d ns/byte)\n", l.ScopeName, f.runs, len(f.corpus), len(f.features), len(f.slow), f.slowCost)
+        sort.Slice(f.slow, func (i, j int) bool { return f.slow[i].cost > f.slow[j].cost })
+        if len(f.slow) > fuzzSlowInputLimit {
+            f.slow = f.slow[:fuzzSlowInputLimit]
+        }
+        for _, input := range f.slow {
+            input = f.minimize(input)
+            filename, err := saveFuzzInput(corpusDirectory, l.ScopeName, input.data)
+            if err != nil {
+                return err
+            }
+            fmt.Printf("%10d ns/byte  %5d bytes  %s\n", input.cost, len(input.data), filename)
+        }
+    }
+    return nil
+}
+
+func newGrammarFuzzer(worker *renderWorker, lang *tm.Language) *grammarFuzzer {
+    f := &grammarFuzzer{
+        worker: worker,
+        lang: lang,
+        random: rand.New(rand.NewSource(time.Now().UnixNano())),
+        features: map[string]bool{},
+    }
+    tokens := map[string]bool{}
+    for _, r := range lang.Patterns {
+        collectFuzzTokens(tokens, r)
+    }
+    for _, k := range sortedRuleKeys(lang.Repository) {
+        collectFuzzTokens(tokens, lang.Repository[k])
+    }
+    for c := byte(' '); c < 0x7f; c++ {
+        if !(c >= 'a' && c <= 'z' || c >= 'A' && c <= 'Z' || c >= '0' && c <= '9') {
+            tokens[string(c)] = true
+        }
+    }
+    tokens["\t"] = true
+    tokens["\n"] = true
+    for t := range tokens {
+        f.tokens = append(f.tokens, t)
+    }
+    sort.Strings(f.tokens)
+
+    // the baseline inputs are lines of seeds, long enough that the cost of
+    // starting a render doesn't count for much.
+    costs := make([]int64, 15)
+    for i := range costs {
+        var data []byte
+        for len(data) < fuzzInputLimit / 4 {
+            data = append(append(data, f.seed()...), '\n')
+        }
+        cost, _, err := f.run(data)
+        if err == nil {
+            cost = f.measure(data, cost)
+        }
+        costs[i] = cost
+    }
+    sort.Slice(costs, func (i, j int) bool { return costs[i] < costs[j] })
+    f.slowCost = costs[len(costs) / 2] * fuzzSlowFactor
+    return f
+}
+
+// -- dictionary
+
+func collectFuzzTokens(tokens map[string]bool, r *tm.Rule) {
+    if r == nil {
+        return
+    }
+    for _, match := range []string{ r.Match, r.Begin, r.End, r.While } {
+        for _, t := range fuzzTokensInRegex(match) {
+            tokens[t] = true
+        }
+    }
+    for _, v := range r.Patterns {
+        collectFuzzTokens(tokens, v)
+    }
+    for _, k := range sortedRuleKeys(r.Repository) {
+        collectFuzzTokens(tokens, r.Repository[k])
+    }
+    for _, captures := range []map[string]tm.Capture{ r.Captures, r.BeginCaptures, r.EndCaptures, r.WhileCaptures } {
+        for _, c := range captures {
+            for _, v := range c.Patterns {
+                collectFuzzTokens(tokens, v)
+            }
+        }
+    }
+}
+
+// the runs of literal characters in a regex: keywords, operators, and
+// delimiters.  escapes like \w and anything inside a character class are
+// skipped, since they don't say which characters to use.
+func fuzzTokensInRegex(s string) []string {
+    var tokens []string
+    var current []byte
+    flush := func () {
+        if len(current) > 0 {
+            tokens = append(tokens, string(current))
+            current = nil
+        }
+    }
+    for i := 0; i < len(s); i++ {
+        c := s[i]
+        switch {
+        case c == '\\' && i + 1 < len(s):
+            i++
+            e := s[i]
+            if e >= 'a' && e <= 'z' || e >= 'A' && e <= 'Z' || e >= '0' && e <= '9' {
+                flush()
+            } else {
+                current = append(current, e)
+            }
+        case c == '[':
+            flush()
+            p := &lintRegexParser{ s: s, i: i + 1 }
+            p.skipClass()
+            i = p.i - 1
+        case c == '(' && i + 1 < len(s) && s[i+1] == '?':
+            // skip over the group's options, like ?: or ?<name> or ?i.
+            flush()
+            for i++; i < len(s) && s[i] != ':' && s[i] != ')' && s[i] != '=' && s[i] != '!' && s[i] != '>'; i++ {
+            }
+        case c == '*' || c == '+' || c == '?' || c == '{':
+            // the last character is repeated, so it doesn't belong to the
+            // run before it.
+            if len(current) > 1 {
+                current = current[:len(current) - 1]
+            }
+            flush()
+            if c == '{' {
+                for ; i < len(s) && s[i] != '}'; i++ {
+                }
+            }
+        case c == '.' || c == '(' || c == ')' || c == '|' || c == '^' || c == '$' || c == ' ' || c == '\n' || c == '\t':
+            flush()
+        default:
+            current = append(current, c)
+        }
+    }
+    flush()
+    return tokens
+}
+
+// -- fuzzing
+
+type fuzzWriter struct {
+    scopes []string
+    features map[string]bool
+}
+
+func (w *fuzzWriter) Write(b []byte) (int, error) {
+    return len(b), nil
+}
+
+func (w *fuzzWriter) BeginScope(scope interface{}) error {
+    name, _ := scope.(string)
+    parent := ""
+    if len(w.scopes) > 0 {
+        parent = w.scopes[len(w.scopes) - 1]
+    }
+    w.features[parent + ">" + name] = true
+    w.scopes = append(w.scopes, name)
+    return nil
+}
+
+func (w *fuzzWriter) EndScope(interface{}) error {
+    if len(w.scopes) > 0 {
+        w.scopes = w.scopes[:len(w.scopes) - 1]
+    }
+    return nil
+}
+
+func (w *fuzzWriter) NewLine() error {
+    return nil
+}
+
+// highlights data in the worker, returning its cost in nanoseconds per byte
+// and the scope transitions it reached.  if the worker timed out, crashed, or
+// reported an error, the cost is that of taking fuzzRunTimeLimit, and the
+// error is returned too.
+func (f *grammarFuzzer) run(data []byte) (int64, map[string]bool, error) {
+    if f.worker.cmd == nil {
+        // the worker loads the grammars for fuzzing on its first fuzz job,
+        // which shouldn't count against the time limit.
+        if _, err := f.worker.run(renderJob{ FuzzScope: f.lang.ScopeName }); err != nil {
+            return fuzzCost(fuzzRunTimeLimit, len(data)), nil, err
+        }
+    }
+    f.runs++
+    result, err := f.worker.runWithTimeLimit(renderJob{ FuzzScope: f.lang.ScopeName, FuzzInput: data }, fuzzRunTimeLimit)
+    if err == nil && len(result.Error) > 0 {
+        err = errors.New(result.Error)
+    }
+    if err != nil {
+        return fuzzCost(fuzzRunTimeLimit, len(data)), nil, err
+    }
+    features := make(map[string]bool, len(result.Features))
+    for _, k := range result.Features {
+        features[k] = true
+    }
+    return fuzzCost(result.Elapsed, len(data)), features, nil
+}
+
+// timings are noisy, so anything that's about to be kept is measured a few
+// more times, keeping the fastest.
+func (f *grammarFuzzer) measure(data []byte, cost int64) int64 {
+    for i := 0; i < 2; i++ {
+        c, _, err := f.run(data)
+        if err != nil {
+            break
+        }
+        if c < cost {
+            cost = c
+        }
+    }
+    return cost
+}
+
+func fuzzCost(elapsed time.Duration, length int) int64 {
+    if length < fuzzCostMinimumLength {
+        length = fuzzCostMinimumLength
+    }
+    return elapsed.Nanoseconds() / int64(length)
+}
+
+func (f *grammarFuzzer) fuzz(duration time.Duration) {
+    deadline := time.Now().Add(duration)
+    for i := 0; i < 8; i++ {
+        f.consider(f.seed(), nil)
+    }
+    for time.Now().Before(deadline) {
+        if len(f.corpus) == 0 {
+            f.consider(f.seed(), nil)
+            continue
+        }
+        parent := f.choose()
+        data := append([]byte(nil), parent.data...)
+        for n := 1 + f.random.Intn(4); n > 0; n-- {
+            data = f.mutate(data)
+        }
+        if len(data) > fuzzInputLimit {
+            data = data[:fuzzInputLimit]
+        }
+        if len(data) > 0 {
+            f.consider(data, parent)
+        }
+    }
+}
+
+// a line or two of tokens from the grammar.
+func (f *grammarFuzzer) seed() []byte {
+    var data []byte
+    for n := 4 + f.random.Intn(32); n > 0; n-- {
+        data = append(data, f.token()...)
+    }
+    return data
+}
+
+func (f *grammarFuzzer) token() string {
+    return f.tokens[f.random.Intn(len(f.tokens))]
+}
+
+// runs data, keeping it if it reached a new scope transition or got slower
+// than its parent.
+func (f *grammarFuzzer) consider(data []byte, parent *fuzzInput) {
+    cost, features, err := f.run(data)
+    if err != nil {
+        log.Printf("%s: %v", f.lang.ScopeName, err)
+        f.slow = append(f.slow, &fuzzInput{ data, cost })
+        return
+    }
+    added := 0
+    for k := range features {
+        if !f.features[k] {
+            f.features[k] = true
+            added++
+        }
+    }
+    slower := parent != nil && cost > parent.cost + parent.cost / 5
+    if added == 0 && !slower && parent != nil {
+        return
+    }
+    cost = f.measure(data, cost)
+    if added == 0 && parent != nil && cost <= parent.cost {
+        return
+    }
+    // slow inputs are mutated further too, in case they can get slower.
+    input := &fuzzInput{ data, cost }
+    if cost > f.slowCost {
+        f.slow = append(f.slow, input)
+    }
+    if len(f.corpus) < fuzzCorpusLimit {
+        f.corpus = append(f.corpus, input)
+        return
+    }
+    cheapest := 0
+    for i, c := range f.corpus {
+        if c.cost < f.corpus[cheapest].cost {
+            cheapest = i
+        }
+    }
+    f.corpus[cheapest] = input
+}
+
+// half the time, one of the slowest inputs, otherwise any of them.
+func (f *grammarFuzzer) choose() *fuzzInput {
+    if f.random.Intn(2) == 0 {
+        sort.Slice(f.corpus, func (i, j int) bool { return f.corpus[i].cost > f.corpus[j].cost })
+        return f.corpus[f.random.Intn(min(8, len(f.corpus)))]
+    }
+    return f.corpus[f.random.Intn(len(f.corpus))]
+}
+
+func (f *grammarFuzzer) mutate(data []byte) []byte {
+    at := f.random.Intn(len(data) + 1)
+    switch f.random.Intn(7) {
+    case 0:
+        return insertBytes(data, at, []byte(f.token()))
+    case 1:
+        return insertBytes(data, at, []byte{ byte(' ' + f.random.Intn(0x5f)) })
+    case 2:
+        // repeating a token is how most backtracking blowups are found.
+        t := f.token()
+        var repeated []byte
+        for n := 2 + f.random.Intn(64); n > 0; n-- {
+            repeated = append(repeated, t...)
+        }
+        return insertBytes(data, at, repeated)
+    case 3:
+        if len(data) == 0 {
+            return data
+        }
+        start := f.random.Intn(len(data))
+        end := start + 1 + f.random.Intn(min(16, len(data) - start))
+        var repeated []byte
+        for n := 1 + f.random.Intn(16); n > 0; n-- {
+            repeated = append(repeated, data[start:end]...)
+        }
+        return insertBytes(data, end, repeated)
+    case 4:
+        if len(data) < 2 {
+            return data
+        }
+        start := f.random.Intn(len(data))
+        end := start + 1 + f.random.Intn(min(32, len(data) - start))
+        return append(data[:start], data[end:]...)
+    case 5:
+        other := f.corpus[f.random.Intn(len(f.corpus))].data
+        start := f.random.Intn(len(other))
+        end := start + 1 + f.random.Intn(len(other) - start)
+        return insertBytes(data, at, other[start:end])
+    default:
+        if len(data) == 0 {
+            return data
+        }
+        data[f.random.Intn(len(data))] = byte(' ' + f.random.Intn(0x5f))
+        return data
+    }
+}
+
+func insertBytes(data []byte, at int, b []byte) []byte {
+    result := make([]byte, 0, len(data) + len(b))
+    result = append(result, data[:at]...)
+    result = append(result, b...)
+    return append(result, data[at:]...)
+}
+
+// removes chunks of the input, halving the chunk size each pass, as long as
+// what's left is still slow.
+func (f *grammarFuzzer) minimize(input *fuzzInput) *fuzzInput {
+    deadline := time.Now().Add(fuzzMinimizeTime)
+    for chunk := len(input.data) / 2; chunk >= 1 && time.Now().Before(deadline); chunk /= 2 {
+        for i := 0; i + chunk <= len(input.data) && time.Now().Before(deadline); {
+            data := append(append([]byte(nil), input.data[:i]...), input.data[i+chunk:]...)
+            cost, _, err := f.run(data)
+            if cost > f.slowCost && err == nil {
+                cost = f.measure(data, cost)
+            }
+            if cost > f.slowCost {
+                input = &fuzzInput{ data, cost }
+            } else {
+                i += chunk
+            }
+        }
+    }
+    return input
+}
+
+// -- worker side
+
+// the fuzzer's highlighter sees full scope names, so every scope counts as
+// coverage.  render workers only load it once they're sent a fuzz job.
+type fuzzHighlighter struct {
+    h *tm.Highlighter
+    languagesByScope map[string]*tm.Language
+}
+
+func loadFuzzGrammars() ([]*tm.Language, map[string]*tm.Language, error) {
+    paths := syntaxDefinitionPaths()
+    if len(paths) == 0 {
+        return nil, nil, fmt.Errorf("set DEZIP_SYNTAX to the grammars to fuzz")
+    }
+    var languages []*tm.Language
+    languagesByScope := map[string]*tm.Language{}
+    for _, p := range paths {
+        l, err := loadLanguage(p)
+        if err != nil {
+            return nil, nil, fmt.Errorf("%s: %v", p, err)
+        }
+        languages = append(languages, l)
+        languagesByScope[l.ScopeName] = l
+    }
+    return languages, languagesByScope, nil
+}
+
+func fuzzJobInWorker(fh **fuzzHighlighter, job renderJob) (result renderJobResult) {
+    defer func () {
+        if r := recover(); r != nil {
+            result = renderJobResult{ Error: fmt.Sprintf("panic during highlighting: %v\n%v", r, string(debug.Stack())) }
+        }
+    }()
+    if *fh == nil {
+        languages, languagesByScope, err := loadFuzzGrammars()
+        if err != nil {
+            return renderJobResult{ Error: err.Error() }
+        }
+        h, err := tm.NewHighlighter(languages, func (scope string) interface{} { return scope })
+        if err != nil {
+            return renderJobResult{ Error: err.Error() }
+        }
+        *fh = &fuzzHighlighter{ h: h, languagesByScope: languagesByScope }
+    }
+    lang := (*fh).languagesByScope[job.FuzzScope]
+    if lang == nil {
+        return renderJobResult{ Error: fmt.Sprintf("no grammar has the scope %s", job.FuzzScope) }
+    }
+    w := &fuzzWriter{ features: map[string]bool{} }
+    start := time.Now()
+    if err := (*fh).h.HighlightLanguage(w, job.FuzzInput, lang); err != nil {
+        return renderJobResult{ Error: err.Error() }
+    }
+    result.Elapsed = time.Since(start)
+    for k := range w.features {
+        result.Features = append(result.Features, k)
+    }
+    return result
+}
+
+// -- corpus
+
+func saveFuzzInput(corpusDirectory string, scope string, data []byte) (string, error) {
+    sum := sha1.Sum(data)
+    filename := path.Join(corpusDirectory, scope, hex.EncodeToString(sum[:8]))
+    return filename, writeFileCreatingDirectory(filename, data)
+}
+
+// highlights every input in the corpus again, failing if any of them are
+// still slow.  saved inputs were only shrunk until they were about to stop
+// being slow, so a fix should make them clearly faster: anything within a
+// factor of two of the threshold still counts, which also keeps timing noise
+// from letting slow inputs pass.
+func replayFuzzCorpus(worker *renderWorker, languagesByScope map[string]*tm.Language, corpusDirectory string) error {
+    scopes, err := ioutil.ReadDir(corpusDirectory)
+    if err != nil {
+        return err
+    }
+    inputs, slow := 0, 0
+    for _, scope := range scopes {
+        l := languagesByScope[scope.Name()]
+        if l == nil {
+            fmt.Printf("skipping %s: no grammar has that scope\n", scope.Name())
+            continue
+        }
+        f := newGrammarFuzzer(worker, l)
+        files, err := ioutil.ReadDir(path.Join(corpusDirectory, scope.Name()))
+        if err != nil {
+            return err
+        }
+        for _, file := range files {
+            filename := path.Join(corpusDirectory, scope.Name(), file.Name())
+            data, err := ioutil.ReadFile(filename)
+            if err != nil {
+                return err
+            }
+            cost, _, err := f.run(data)
+            if err == nil {
+                cost = f.measure(data, cost)
+            } else {
+                log.Printf("%s: %v", filename, err)
+            }
+            status := "ok"
+            if err != nil || cost > f.slowCost / 2 {
+                status = "slow"
+                slow++
+            }
+            inputs++
+            fmt.Printf("%10d ns/byte  %-4s  %s\n", cost, status, filename)
+        }
+    }
+    if slow > 0 {
+        return fmt.Errorf("%d of %d inputs are still slow", slow, inputs)
+    }
+    fmt.Printf("%d inputs, none slow\n", inputs)
+    return nil
+}
@@ -1,6 +1,6 @@
 module dezip.org/dezip
 
-go 1.15
+go 1.17
 
 require (
 	github.com/jlaffaye/ftp v0.0.0-20201112195030-9aae4d151126
@@ -10,3 +10,8 @@ require (
 	github.com/yuin/goldmark v1.3.1
 	howett.net/plist v0.0.0-20201203080718-1454fab16a06
 )
+
+require (
+	golang.org/x/net v0.0.0-20201216054612-986b41b23924 // indirect
+	golang.org/x/text v0.3.3 // indirect
+)
@@ -0,0 +1,281 @@
+package main
+
+import (
+    "bytes"
+    "compress/gzip"
+    "container/list"
+    "hash/fnv"
+    "io"
+    "net/http"
+    "strconv"
+    "strings"
+    "sync"
+)
+
+// most requests are for a handful of pages -- readmes and the top directories
+// of popular archives -- which would otherwise be stat'ed, opened, and copied
+// from disk every time.  pages of finished archives don't change until the
+// archive is reclaimed, so the most requested ones are kept in memory, along
+// with a gzipped copy for clients that accept it.
+const hotPageCacheSize = 64 << 20 // 64 MB, counting both copies
+const hotPageSizeLimit = 1 << 20
+
+// a page isn't worth keeping the first time it's requested, since most pages
+// are only ever requested once.  request counts are estimated with a
+// count-min sketch of hotPageSketchRows rows of hotPageSketchWidth counters.
+// once the cache is full, a page only displaces the least recently used one
+// if it's been requested more often.  every hotPageSketchPeriod requests, the
+// counts are halved, so pages which were popular once don't stay forever.
+const hotPageAdmissionCount = 2
+const hotPageSketchRows = 4
+const hotPageSketchWidth = 1 << 14
+const hotPageSketchPeriod = 10 * hotPageSketchWidth
+
+type hotPage struct {
+    key string
+    // the page belongs to this archive.  if the url is reclaimed and
+    // downloaded again, the new archive won't match, so stale pages can't be
+    // served even if they haven't been evicted yet.
+    archive *archive
+    body []byte
+    // nil if gzip doesn't make the page smaller.
+    gzipped []byte
+}
+
+func (p *hotPage) size() int {
+    return len(p.key) + len(p.body) + len(p.gzipped)
+}
+
+type hotPageCache struct {
+    mutex sync.Mutex
+    pages map[string]*list.Element
+    // most recently used first.
+    lru *list.List
+    size int
+    sketch [hotPageSketchRows][hotPageSketchWidth]uint8
+    sketchIncrements int
+}
+
+func newHotPageCache() *hotPageCache {
+    return &hotPageCache{
+        pages: map[string]*list.Element{},
+        lru: list.New(),
+    }
+}
+
+// -- request counts
+
+// call with h.mutex held.
+func (h *hotPageCache) sketchIndexes(key string) (indexes [hotPageSketchRows]int) {
+    f := fnv.New64a()
+    io.WriteString(f, key)
+    x := f.Sum64()
+    for i := range indexes {
+        indexes[i] = int(x % hotPageSketchWidth)
+        x /= hotPageSketchWidth
+    }
+    return
+}
+
+// call with h.mutex held.
+func (h *hotPageCache) count(key string) int {
+    n := 255
+    for row, i := range h.sketchIndexes(key) {
+        if int(h.sketch[row][i]) < n {
+            n = int(h.sketch[row][i])
+        }
+    }
+    return n
+}
+
+// call with h.mutex held.
+func (h *hotPageCache) increment(key string) {
+    for row, i := range h.sketchIndexes(key) {
+        if h.sketch[row][i] < 255 {
+            h.sketch[row][i]++
+        }
+    }
+    h.sketchIncrements++
+    if h.sketchIncrements >= hotPageSketchPeriod {
+        for row := range h.sketch {
+            for i := range h.sketch[row] {
+                h.sketch[row][i] /= 2
+            }
+        }
+        h.sketchIncrements = 0
+    }
+}
+
+// -- serving and admission
+
+// writes the page for key, if it's cached for ar, and returns true.
+// otherwise, counts the request and returns false.
+func (h *hotPageCache) serve(response http.ResponseWriter, request *http.Request, key string, ar *archive) bool {
+    h.mutex.Lock()
+    h.increment(key)
+    element := h.pages[key]
+    if element == nil || element.Value.(*hotPage).archive != ar {
+        h.mutex.Unlock()
+        return false
+    }
+    h.lru.MoveToFront(element)
+    page := element.Value.(*hotPage)
+    h.mutex.Unlock()
+
+    body := page.body
+    response.Header().Set("Content-Type", "text/html;charset=utf-8")
+    response.Header().Set("Vary", "Accept-Encoding")
+    if page.gzipped != nil && acceptsGzip(request) {
+        body = page.gzipped
+        response.Header().Set("Content-Encoding", "gzip")
+    }
+    response.Header().Set("Content-Length", strconv.Itoa(len(body)))
+    response.Write(body)
+    return true
+}
+
+// if the page for key has been requested often enough to keep, reads it from
+// f and returns it.  otherwise, returns nil, and the caller should send f as
+// usual -- f is left at the start.  an error means f couldn't be put back
+// there, and nothing can be sent.
+func (h *hotPageCache) admit(key string, ar *archive, f io.ReadSeeker, size int64) ([]byte, error) {
+    if size > hotPageSizeLimit {
+        return nil, nil
+    }
+    ar.mutex.Lock()
+    finished := ar.state == archiveStateFinished
+    ar.mutex.Unlock()
+    if !finished {
+        // pages are still being written (and rewritten, when a plain version
+        // is replaced by a highlighted one).
+        return nil, nil
+    }
+    h.mutex.Lock()
+    wanted := h.wanted(key, ar, int(size))
+    h.mutex.Unlock()
+    if !wanted {
+        return nil, nil
+    }
+
+    body, err := io.ReadAll(io.LimitReader(f, hotPageSizeLimit + 1))
+    if err != nil || len(body) > hotPageSizeLimit {
+        // some of the page may have been read.
+        if _, err := f.Seek(0, io.SeekStart); err != nil {
+            return nil, err
+        }
+        return nil, nil
+    }
+    page := &hotPage{ key: key, archive: ar, body: body }
+    var gzipped bytes.Buffer
+    w := gzip.NewWriter(&gzipped)
+    w.Write(body)
+    if w.Close() == nil && gzipped.Len() < len(body) {
+        page.gzipped = gzipped.Bytes()
+    }
+
+    h.mutex.Lock()
+    defer h.mutex.Unlock()
+    if !h.wanted(key, ar, page.size()) {
+        // another request got here first, or more popular pages did.
+        return body, nil
+    }
+    if element := h.pages[key]; element != nil {
+        // a page left over from a reclaimed archive.
+        h.remove(element)
+    }
+    for h.size + page.size() > hotPageCacheSize {
+        h.remove(h.lru.Back())
+    }
+    h.pages[key] = h.lru.PushFront(page)
+    h.size += page.size()
+    return body, nil
+}
+
+// call with h.mutex held.
+func (h *hotPageCache) wanted(key string, ar *archive, size int) bool {
+    if element := h.pages[key]; element != nil && element.Value.(*hotPage).archive == ar {
+        return false
+    }
+    n := h.count(key)
+    if n < hotPageAdmissionCount {
+        return false
+    }
+    // the page has to be more popular than everything it would displace.
+    free := hotPageCacheSize - h.size
+    for element := h.lru.Back(); free < size && element != nil; element = element.Prev() {
+        victim := element.Value.(*hotPage)
+        if h.count(victim.key) >= n {
+            return false
+        }
+        free += victim.size()
+    }
+    return free >= size
+}
+
+// call with h.mutex held.
+func (h *hotPageCache) remove(element *list.Element) {
+    page := h.lru.Remove(element).(*hotPage)
+    delete(h.pages, page.key)
+    h.size -= page.size()
+}
+
+// throws away the pages of ar, which is being reclaimed.
+func (h *hotPageCache) evictArchive(ar *archive) {
+    h.mutex.Lock()
+    defer h.mutex.Unlock()
+    for element := h.lru.Front(); element != nil; {
+        next := element.Next()
+        if element.Value.(*hotPage).archive == ar {
+            h.remove(element)
+        }
+        element = next
+    }
+}
+
+// -- restarts
+
+// returns the cached pages, most recently used first, to hand to a successor
+// (see restart.go).
+func (h *hotPageCache) snapshot() []*hotPage {
+    h.mutex.Lock()
+    defer h.mutex.Unlock()
+    pages := make([]*hotPage, 0, h.lru.Len())
+    for element := h.lru.Front(); element != nil; element = element.Next() {
+        pages = append(pages, element.Value.(*hotPage))
+    }
+    return pages
+}
+
+// adds a page handed over by a predecessor, counting it as requested often
+// enough to keep.  call in the order of the predecessor's snapshot().
+func (h *hotPageCache) warm(page *hotPage) bool {
+    h.mutex.Lock()
+    defer h.mutex.Unlock()
+    if h.pages[page.key] != nil || h.size + page.size() > hotPageCacheSize {
+        return false
+    }
+    for i := 0; i < hotPageAdmissionCount; i++ {
+        h.increment(page.key)
+    }
+    h.pages[page.key] = h.lru.PushBack(page)
+    h.size += page.size()
+    return true
+}
+
+func acceptsGzip(request *http.Request) bool {
+    for _, header := range request.Header["Accept-Encoding"] {
+        for _, coding := range strings.Split(header, ",") {
+            parameters := strings.Split(coding, ";")
+            if strings.TrimSpace(parameters[0]) != "gzip" {
+                continue
+            }
+            for _, parameter := range parameters[1:] {
+                if q := strings.TrimSpace(parameter); strings.HasPrefix(q, "q=0") && strings.Trim(q[2:], "0.") == "" {
+                    return false
+                }
+            }
+            return true
+        }
+    }
+    return false
+}
@@ -0,0 +1,89 @@
+// inflate.go
+
+// decompresses deflate streams with zlib, which is about twice as fast as
+// compress/flate.  the whole stream is decompressed in one call, straight into
+// a buffer of the expected size, which is zlib's fastest path.  calls don't
+// share any state, so any number of them can run at once.
+package inflate
+
+// #cgo pkg-config: zlib
+// #include <string.h>
+// #include <zlib.h>
+//
+// static int inflateRaw(unsigned char *src, size_t srcLength, unsigned char *dst, size_t dstLength) {
+//     z_stream s;
+//     memset(&s, 0, sizeof(s));
+//     if (inflateInit2(&s, -MAX_WBITS) != Z_OK) {
+//         return Z_MEM_ERROR;
+//     }
+//     s.next_in = src;
+//     s.avail_in = (uInt)srcLength;
+//     s.next_out = dst;
+//     s.avail_out = (uInt)dstLength;
+//     int result = inflate(&s, Z_FINISH);
+//     if (result == Z_STREAM_END && s.total_out != dstLength) {
+//         result = Z_BUF_ERROR;
+//     }
+//     inflateEnd(&s);
+//     return result;
+// }
+import "C"
+
+import (
+    "bytes"
+    "compress/flate"
+    "errors"
+    "io"
+    "math"
+    "unsafe"
+)
+
+var ErrSize = errors.New("inflate: uncompressed data isn't the expected size")
+var ErrCorrupt = errors.New("inflate: corrupt deflate stream")
+
+// decompresses the raw deflate stream in src into dst, which must be exactly
+// as long as the uncompressed data.
+func Inflate(dst []byte, src []byte) error {
+    if len(src) == 0 {
+        return ErrCorrupt
+    }
+    if len(dst) == 0 {
+        // there's nowhere to point zlib, but there's nothing to write either.
+        // it's enough that the stream decodes to nothing.
+        n, err := io.Copy(io.Discard, flate.NewReader(bytes.NewReader(src)))
+        if err != nil {
+            return ErrCorrupt
+        } else if n != 0 {
+            return ErrSize
+        }
+        return nil
+    }
+    if len(src) > math.MaxUint32 || len(dst) > math.MaxUint32 {
+        // zlib counts in 32 bits.  dezip never reads files this big, so
+        // don't bother feeding it in pieces.
+        return inflateWithGo(dst, src)
+    }
+    switch C.inflateRaw((*C.uchar)(unsafe.Pointer(&src[0])), C.size_t(len(src)), (*C.uchar)(unsafe.Pointer(&dst[0])), C.size_t(len(dst))) {
+    case C.Z_STREAM_END:
+        return nil
+    case C.Z_BUF_ERROR:
+        // dst filled up before the end of the stream, the stream ended
+        // before dst was full, or src was cut off.
+        return ErrSize
+    case C.Z_MEM_ERROR:
+        return errors.New("inflate: out of memory")
+    default:
+        return ErrCorrupt
+    }
+}
+
+func inflateWithGo(dst []byte, src []byte) error {
+    r := flate.NewReader(bytes.NewReader(src))
+    if _, err := io.ReadFull(r, dst); err != nil {
+        return ErrSize
+    }
+    if n, err := r.Read(make([]byte, 1)); n != 0 || err != io.EOF {
+        return ErrSize
+    }
+    return nil
+}
@@ -0,0 +1,194 @@
+package main
+
+import (
+    "bufio"
+    "fmt"
+    "log"
+    "os"
+    "runtime"
+    "strconv"
+    "strings"
+    "time"
+)
+
+// running `dezip ingest url...` downloads and renders archives without
+// starting the web server, writing the same root, text, and meta directories
+// the server reads at startup.  this is useful for warming the cache with
+// popular archives ahead of time.
+//
+// each argument is either an archive url, or url=path to render the local
+// file at path as if it had been downloaded from url.  an argument of -
+// reads more arguments from stdin, one per line.
+const ingestCommand = "ingest"
+
+// how often to check on the archives being ingested.
+const ingestPollInterval = 250 * time.Millisecond
+
+type ingestJob struct {
+    page page
+    archivePath string
+    protocol protocol
+    archive *archive
+    startTime time.Time
+}
+
+func (c *cache) ingest(args []string) error {
+    var entries []string
+    for _, arg := range args {
+        if arg != "-" {
+            entries = append(entries, arg)
+            continue
+        }
+        scanner := bufio.NewScanner(os.Stdin)
+        for scanner.Scan() {
+            if line := strings.TrimSpace(scanner.Text()); len(line) > 0 {
+                entries = append(entries, line)
+            }
+        }
+        if err := scanner.Err(); err != nil {
+            return err
+        }
+    }
+    var jobs []*ingestJob
+    for _, entry := range entries {
+        job, err := newIngestJob(entry)
+        if err != nil {
+            return err
+        }
+        jobs = append(jobs, job)
+    }
+    if len(jobs) == 0 {
+        return fmt.Errorf("usage: dezip %s url[=path]...", ingestCommand)
+    }
+
+    // there's nobody waiting on pages, so use every core for rendering.
+    for i := 0; i < runtime.NumCPU(); i++ {
+        r, err := newRenderer()
+        if err != nil {
+            return err
+        }
+        go r.renderLoop(c, false)
+    }
+    go c.reclaimUnfinishedArchivesOnExit()
+
+    pending := jobs
+    var active []*ingestJob
+    failures := 0
+    for len(pending) > 0 || len(active) > 0 {
+        // start as many archives as activeArchiveLimit allows.
+        for len(pending) > 0 {
+            job := pending[0]
+            c.mutex.Lock()
+            if c.archivesByURL[job.page.archiveURL] != nil {
+                c.mutex.Unlock()
+                log.Printf("skipping %s: already in the cache", job.page.archiveURL)
+                pending = pending[1:]
+                continue
+            }
+            ar := newArchive(job.archivePath)
+            if ar == nil {
+                c.mutex.Unlock()
+                break
+            }
+            c.archivesByURL[job.page.archiveURL] = ar
+            c.archiveURLsToReclaim = append(c.archiveURLsToReclaim, job.page.archiveURL)
+            c.mutex.Unlock()
+
+            log.Printf("ingesting %s", job.page.archiveURL)
+            job.archive = ar
+            job.startTime = time.Now()
+            ar.mutex.Lock()
+            c.startDownload(ar, job.page, job.protocol)
+            ar.mutex.Unlock()
+            active = append(active, job)
+            pending = pending[1:]
+        }
+        time.Sleep(ingestPollInterval)
+        stillActive := active[:0]
+        for _, job := range active {
+            job.archive.mutex.Lock()
+            state := job.archive.state
+            reason := job.archive.failureReason
+            job.archive.mutex.Unlock()
+            switch state {
+            case archiveStateFinished:
+                log.Printf("finished %s in %v", job.page.archiveURL, time.Since(job.startTime).Round(time.Millisecond))
+            case archiveStateFailed:
+                log.Printf("failed %s: %v", job.page.archiveURL, reason)
+                failures++
+            default:
+                stillActive = append(stillActive, job)
+            }
+        }
+        active = stillActive
+    }
+    if failures > 0 {
+        return fmt.Errorf("%d of %d archives failed to ingest", failures, len(jobs))
+    }
+    return nil
+}
+
+func newIngestJob(arg string) (*ingestJob, error) {
+    if !strings.Contains(arg, "://") {
+        return nil, fmt.Errorf("%s: expected a url (use url=path to ingest a local file)", arg)
+    }
+    rawurl := arg
+    var protocol protocol
+    if i := strings.LastIndex(arg, "="); i >= 0 {
+        if info, err := os.Stat(arg[i+1:]); err == nil && !info.IsDir() {
+            rawurl = arg[:i]
+            protocol = localFileProtocol{ arg[i+1:] }
+        }
+    }
+    // construct the archive path the same way ServeHTTP does for urls of the
+    // form dezip.org/scheme://....
+    components := strings.Split("/" + rawurl, "/")
+    if len(components) < 4 || !strings.HasSuffix(components[1], ":") {
+        return nil, fmt.Errorf("%s: invalid url", rawurl)
+    }
+    rewrittenPath := rewriteURLv1(components)
+    if len(rewrittenPath) > URLPathLimit {
+        return nil, fmt.Errorf("%s: url too long", rawurl)
+    }
+    components = strings.Split(rewrittenPath, "/")
+    if len(components) > URLComponentLimit {
+        return nil, fmt.Errorf("%s: too many components in url", rawurl)
+    }
+    length, err := strconv.Atoi(components[2])
+    if err != nil || length < 5 || length > len(components) {
+        return nil, fmt.Errorf("%s: invalid url", rawurl)
+    }
+    archiveComponents := components[:length]
+    scheme := archiveComponents[3]
+    if protocol == nil {
+        var ok bool
+        if protocol, ok = protocols[scheme]; !ok {
+            return nil, fmt.Errorf("%s: i don't know how to download %s:// urls", rawurl, scheme)
+        }
+    }
+    return &ingestJob{
+        page: page{
+            isDirectory: true,
+            archiveURL: fmt.Sprintf("%s://%s", scheme, strings.Join(archiveComponents[4:], "/")),
+        },
+        archivePath: strings.Join(archiveComponents, "/"),
+        protocol: protocol,
+    }, nil
+}
+
+// reads an archive from the local filesystem instead of downloading it.
+type localFileProtocol struct {
+    path string
+}
+func (p localFileProtocol) fetch(url string) (response, error) {
+    f, err := os.Open(p.path)
+    if err != nil {
+        return response{}, err
+    }
+    info, err := f.Stat()
+    if err != nil {
+        f.Close()
+        return response{}, err
+    }
+    return response{ f, info.Size() }, nil
+}
@@ -0,0 +1,609 @@
+package main
+
+import (
+    "fmt"
+    "os"
+    "sort"
+    "strings"
+
+    "howett.net/plist"
+    "dezip.org/dezip/tmlanguage"
+)
+
+// running `dezip lint-grammars [path...]` checks the syntax definitions in
+// DEZIP_SYNTAX (or the given files) for regexes and states that are likely to
+// make highlighting slow, and prints what it finds, worst first.  the checks
+// are heuristics -- a flagged pattern isn't necessarily slow, but it's a good
+// place to look when a new grammar makes rendering crawl.
+const lintGrammarsCommand = "lint-grammars"
+
+// states which try more patterns than this at every position are flagged.
+const lintLargeStatePatterns = 150
+
+// lookbehinds are flagged in states with more patterns than this, since
+// they're tried so often.
+const lintHotStatePatterns = 100
+
+// alternations with more branches than this are flagged.
+const lintAlternationBranches = 40
+
+type lintFinding struct {
+    score int
+    language string
+    location string
+    message string
+    pattern string
+}
+
+// where a rule was found in its grammar, like repository.strings.patterns[2].
+type lintRuleLocation struct {
+    language *tm.Language
+    path string
+}
+
+func lintGrammars(args []string) error {
+    paths := args
+    if len(paths) == 0 {
+        paths = syntaxDefinitionPaths()
+    }
+    if len(paths) == 0 {
+        return fmt.Errorf("usage: dezip %s path... (or set DEZIP_SYNTAX)", lintGrammarsCommand)
+    }
+    var languages []*tm.Language
+    for _, p := range paths {
+        l, err := loadLanguage(p)
+        if err != nil {
+            return fmt.Errorf("%s: %v", p, err)
+        }
+        languages = append(languages, l)
+    }
+
+    var findings []lintFinding
+    locations := map[*tm.Rule]lintRuleLocation{}
+    for _, lang := range languages {
+        for i, r := range lang.Patterns {
+            findings = lintRule(findings, locations, lang, r, fmt.Sprintf("patterns[%d]", i))
+        }
+        for _, k := range sortedRuleKeys(lang.Repository) {
+            findings = lintRule(findings, locations, lang, lang.Repository[k], "repository." + k)
+        }
+    }
+
+    // states are only known once includes have been followed, which takes
+    // building a highlighter.
+    states, err := tm.DescribeStates(languages)
+    if err != nil {
+        fmt.Fprintf(os.Stdout, "couldn't build a highlighter, so states weren't checked: %v\n\n", err)
+    }
+    largestState := map[*tm.Rule]int{}
+    for _, s := range states {
+        for _, r := range s.Rules {
+            if len(s.Rules) > lintHotStatePatterns && len(s.Rules) > largestState[r] {
+                largestState[r] = len(s.Rules)
+            }
+        }
+        if len(s.Rules) <= lintLargeStatePatterns {
+            continue
+        }
+        where := "start state"
+        pattern := ""
+        if s.Rule != nil {
+            where = "state entered by " + locations[s.Rule].path
+            pattern = s.Rule.Begin
+            if s.Capture != "" {
+                where = fmt.Sprintf("state for capture %s of %s", s.Capture, locations[s.Rule].path)
+                pattern = ""
+            }
+        }
+        findings = append(findings, lintFinding{
+            score: len(s.Rules) / 5,
+            language: s.Language.ScopeName,
+            location: where,
+            message: fmt.Sprintf("large regset: %d patterns are tried at every position", len(s.Rules)),
+            pattern: pattern,
+        })
+    }
+    for r, size := range largestState {
+        for _, match := range []string{ r.Match, r.Begin } {
+            if match == "" || !parseLintRegex(match).has(func (n *lintRegexNode) bool { return n.group == lintLookbehind }) {
+                continue
+            }
+            findings = append(findings, lintFinding{
+                score: 10 + size / 10,
+                language: locations[r].language.ScopeName,
+                location: locations[r].path,
+                message: fmt.Sprintf("lookbehind in a hot state (%d patterns)", size),
+                pattern: match,
+            })
+        }
+    }
+
+    sort.SliceStable(findings, func (i, j int) bool {
+        if findings[i].score != findings[j].score {
+            return findings[i].score > findings[j].score
+        }
+        if findings[i].language != findings[j].language {
+            return findings[i].language < findings[j].language
+        }
+        return findings[i].location < findings[j].location
+    })
+    for _, f := range findings {
+        fmt.Printf("%5d  %s  %s: %s\n", f.score, f.language, f.location, f.message)
+        if f.pattern != "" {
+            p := strings.Join(strings.Fields(f.pattern), " ")
+            if len(p) > 120 {
+                p = p[:117] + "..."
+            }
+            fmt.Printf("       %s\n", p)
+        }
+    }
+    fmt.Printf("%d findings in %d grammars, %d states\n", len(findings), len(languages), len(states))
+    return nil
+}
+
+func loadLanguage(p string) (*tm.Language, error) {
+    rc, err := os.Open(p)
+    if err != nil {
+        return nil, err
+    }
+    defer rc.Close()
+    l := &tm.Language{}
+    if err := plist.NewDecoder(rc).Decode(l); err != nil {
+        return nil, err
+    }
+    return l, nil
+}
+
+func sortedRuleKeys(m map[string]*tm.Rule) []string {
+    keys := make([]string, 0, len(m))
+    for k := range m {
+        keys = append(keys, k)
+    }
+    sort.Strings(keys)
+    return keys
+}
+
+func lintRule(findings []lintFinding, locations map[*tm.Rule]lintRuleLocation, lang *tm.Language, r *tm.Rule, path string) []lintFinding {
+    if r == nil || r.Disabled != 0 {
+        return findings
+    }
+    locations[r] = lintRuleLocation{ lang, path }
+    for _, p := range []struct{ key, match string }{
+        { "match", r.Match }, { "begin", r.Begin }, { "end", r.End }, { "while", r.While },
+    } {
+        if p.match == "" {
+            continue
+        }
+        for _, problem := range parseLintRegex(p.match).problems(p.key == "match" || p.key == "begin") {
+            findings = append(findings, lintFinding{
+                score: problem.score,
+                language: lang.ScopeName,
+                location: path + "." + p.key,
+                message: problem.message,
+                pattern: p.match,
+            })
+        }
+        if (p.key == "end" || p.key == "while") && parseLintRegex(p.match).has(func (n *lintRegexNode) bool { return n.kind == lintBackreference }) {
+            findings = append(findings, lintFinding{
+                score: 15,
+                language: lang.ScopeName,
+                location: path + "." + p.key,
+                message: "backreferencing " + p.key + " pattern is compiled again for every begin match",
+                pattern: p.match,
+            })
+        }
+    }
+    for i, v := range r.Patterns {
+        findings = lintRule(findings, locations, lang, v, fmt.Sprintf("%s.patterns[%d]", path, i))
+    }
+    for _, k := range sortedRuleKeys(r.Repository) {
+        findings = lintRule(findings, locations, lang, r.Repository[k], path + ".repository." + k)
+    }
+    for _, captures := range []map[string]tm.Capture{ r.Captures, r.BeginCaptures, r.EndCaptures, r.WhileCaptures } {
+        for k, c := range captures {
+            for i, v := range c.Patterns {
+                findings = lintRule(findings, locations, lang, v, fmt.Sprintf("%s.captures.%s.patterns[%d]", path, k, i))
+            }
+            for _, rk := range sortedRuleKeys(c.Repository) {
+                findings = lintRule(findings, locations, lang, c.Repository[rk], path + ".captures." + k + ".repository." + rk)
+            }
+        }
+    }
+    return findings
+}
+
+// -- regex structure
+
+// just enough of a parser for oniguruma's syntax to see how a regex is put
+// together: groups, alternations, and quantifiers.  everything else is an
+// opaque atom.
+type lintRegexKind int
+const (
+    lintAtom lintRegexKind = iota
+    lintAnyCharacter
+    lintAnchor
+    lintBackreference
+    lintGroup
+)
+
+type lintGroupKind int
+const (
+    lintCapturingGroup lintGroupKind = iota
+    lintNonCapturingGroup
+    lintLookahead
+    lintLookbehind
+    lintAtomicGroup
+)
+
+type lintRegexNode struct {
+    kind lintRegexKind
+    group lintGroupKind
+    alternatives [][]*lintRegexNode
+    // the quantifier applied to the node.  max is -1 for unbounded.
+    min, max int
+    // possessive quantifiers and atomic groups never backtrack.
+    possessive bool
+    literal bool
+}
+
+type lintRegexParser struct {
+    s string
+    i int
+    extended bool
+}
+
+func parseLintRegex(s string) *lintRegexNode {
+    p := &lintRegexParser{ s: s }
+    root := &lintRegexNode{ kind: lintGroup, group: lintNonCapturingGroup, min: 1, max: 1 }
+    root.alternatives = p.alternatives()
+    return root
+}
+
+func (p *lintRegexParser) alternatives() [][]*lintRegexNode {
+    alternatives := [][]*lintRegexNode{ nil }
+    for p.i < len(p.s) {
+        c := p.s[p.i]
+        if c == ')' {
+            p.i++
+            break
+        }
+        if c == '|' {
+            p.i++
+            alternatives = append(alternatives, nil)
+            continue
+        }
+        if p.extended && (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            p.i++
+            continue
+        }
+        if p.extended && c == '#' {
+            for p.i < len(p.s) && p.s[p.i] != '\n' {
+                p.i++
+            }
+            continue
+        }
+        n := p.atom()
+        if n == nil {
+            continue
+        }
+        p.quantifier(n)
+        last := len(alternatives) - 1
+        alternatives[last] = append(alternatives[last], n)
+    }
+    return alternatives
+}
+
+func (p *lintRegexParser) atom() *lintRegexNode {
+    n := &lintRegexNode{ kind: lintAtom, min: 1, max: 1 }
+    c := p.s[p.i]
+    p.i++
+    switch c {
+    case '.':
+        n.kind = lintAnyCharacter
+    case '^', '$':
+        n.kind = lintAnchor
+    case '[':
+        p.skipClass()
+    case '\\':
+        if p.i >= len(p.s) {
+            return n
+        }
+        e := p.s[p.i]
+        p.i++
+        switch {
+        case e >= '1' && e <= '9':
+            n.kind = lintBackreference
+            for p.i < len(p.s) && p.s[p.i] >= '0' && p.s[p.i] <= '9' {
+                p.i++
+            }
+        case e == 'k' || e == 'g':
+            if e == 'k' {
+                n.kind = lintBackreference
+            }
+            p.skipDelimited()
+        case e == 'A' || e == 'z' || e == 'Z' || e == 'G' || e == 'b' || e == 'B':
+            n.kind = lintAnchor
+        case e == 'p' || e == 'P' || e == 'x' || e == 'o':
+            if p.i < len(p.s) && p.s[p.i] == '{' {
+                p.skipDelimited()
+            } else if e == 'x' {
+                p.i += min(2, len(p.s) - p.i)
+            }
+        case e == 'u':
+            p.i += min(4, len(p.s) - p.i)
+        case e == 'w' || e == 'W' || e == 's' || e == 'S' || e == 'd' || e == 'D' || e == 'h' || e == 'H':
+        default:
+            n.literal = true
+        }
+    case '(':
+        n.kind = lintGroup
+        n.group = lintCapturingGroup
+        if p.i < len(p.s) && p.s[p.i] == '?' {
+            p.i++
+            if p.i >= len(p.s) {
+                return nil
+            }
+            switch g := p.s[p.i]; {
+            case g == '#':
+                for p.i < len(p.s) && p.s[p.i] != ')' {
+                    p.i++
+                }
+                p.i++
+                return nil
+            case g == ':':
+                p.i++
+                n.group = lintNonCapturingGroup
+            case g == '=' || g == '!':
+                p.i++
+                n.group = lintLookahead
+            case g == '>':
+                p.i++
+                n.group = lintAtomicGroup
+            case g == '<' && p.i + 1 < len(p.s) && (p.s[p.i+1] == '=' || p.s[p.i+1] == '!'):
+                p.i += 2
+                n.group = lintLookbehind
+            case g == '<' || g == '\'' || g == 'P':
+                p.skipDelimited()
+            default:
+                // option settings like (?i) or (?x-i:...).
+                start := p.i
+                for p.i < len(p.s) && p.s[p.i] != ':' && p.s[p.i] != ')' {
+                    p.i++
+                }
+                options := p.s[start:p.i]
+                if off := strings.IndexByte(options, '-'); off >= 0 {
+                    options = options[:off]
+                }
+                if strings.IndexByte(options, 'x') >= 0 {
+                    p.extended = true
+                }
+                if p.i < len(p.s) && p.s[p.i] == ')' {
+                    p.i++
+                    return nil
+                }
+                p.i++
+                n.group = lintNonCapturingGroup
+            }
+        }
+        n.alternatives = p.alternatives()
+        n.possessive = n.group == lintAtomicGroup
+    default:
+        n.literal = true
+    }
+    return n
+}
+
+// skips a character class, which can contain nested classes and posix
+// brackets like [:alpha:].
+func (p *lintRegexParser) skipClass() {
+    depth := 1
+    if p.i < len(p.s) && p.s[p.i] == '^' {
+        p.i++
+    }
+    if p.i < len(p.s) && p.s[p.i] == ']' {
+        p.i++
+    }
+    for p.i < len(p.s) && depth > 0 {
+        switch p.s[p.i] {
+        case '\\':
+            p.i++
+        case '[':
+            if p.i + 1 < len(p.s) && p.s[p.i+1] == ':' {
+                if end := strings.Index(p.s[p.i:], ":]"); end >= 0 {
+                    p.i += end + 1
+                }
+            } else {
+                depth++
+            }
+        case ']':
+            depth--
+        }
+        p.i++
+    }
+}
+
+// skips a name like <name>, 'name', or {name}.
+func (p *lintRegexParser) skipDelimited() {
+    if p.i >= len(p.s) {
+        return
+    }
+    closing := map[byte]byte{ '<': '>', '\'': '\'', '{': '}', 'P': '>' }[p.s[p.i]]
+    if closing == 0 {
+        return
+    }
+    for p.i++; p.i < len(p.s) && p.s[p.i] != closing; p.i++ {
+    }
+    p.i++
+}
+
+func (p *lintRegexParser) quantifier(n *lintRegexNode) {
+    for p.extended && p.i < len(p.s) && p.s[p.i] == ' ' {
+        p.i++
+    }
+    if p.i >= len(p.s) {
+        return
+    }
+    switch p.s[p.i] {
+    case '*':
+        n.min, n.max = 0, -1
+    case '+':
+        n.min, n.max = 1, -1
+    case '?':
+        n.min, n.max = 0, 1
+    case '{':
+        end := strings.IndexByte(p.s[p.i:], '}')
+        if end < 0 {
+            return
+        }
+        var lo, hi int
+        body := p.s[p.i+1:p.i+end]
+        if c, err := fmt.Sscanf(body, "%d,%d", &lo, &hi); err == nil && c == 2 {
+            n.min, n.max = lo, hi
+        } else if strings.HasSuffix(body, ",") {
+            if _, err := fmt.Sscanf(body, "%d,", &lo); err != nil {
+                return
+            }
+            n.min, n.max = lo, -1
+        } else if _, err := fmt.Sscanf(body, "%d", &lo); err == nil && !strings.Contains(body, ",") {
+            n.min, n.max = lo, lo
+        } else {
+            return
+        }
+        p.i += end
+    default:
+        return
+    }
+    p.i++
+    if p.i < len(p.s) && (p.s[p.i] == '+' || p.s[p.i] == '?') {
+        n.possessive = p.s[p.i] == '+'
+        p.i++
+    }
+}
+
+// does f return true for n or anything inside it?
+func (n *lintRegexNode) has(f func (*lintRegexNode) bool) bool {
+    if f(n) {
+        return true
+    }
+    for _, alternative := range n.alternatives {
+        for _, child := range alternative {
+            if child.has(f) {
+                return true
+            }
+        }
+    }
+    return false
+}
+
+func (n *lintRegexNode) unbounded() bool {
+    return n.max < 0 && !n.possessive
+}
+
+type lintProblem struct {
+    score int
+    message string
+}
+
+// searched is true for match and begin patterns, which are searched for at
+// every position rather than matched where the previous match left off.
+func (n *lintRegexNode) problems(searched bool) []lintProblem {
+    var problems []lintProblem
+    if n.has(func (n *lintRegexNode) bool { return n.kind == lintGroup && n.unbounded() && n.hasAmbiguousRepetition() }) {
+        problems = append(problems, lintProblem{ 100, "nested quantifiers can backtrack catastrophically" })
+    }
+    if searched {
+        for _, alternative := range n.alternatives {
+            // a wildcard that's followed by something it can fail on is
+            // retried from every position, making each line quadratic.
+            if len(alternative) > 1 && alternative[0].kind == lintAnyCharacter && alternative[0].unbounded() && requiresMore(alternative[1:]) {
+                problems = append(problems, lintProblem{ 40, "leading .* without an anchor is retried from every position" })
+                break
+            }
+        }
+    }
+    if n.has(func (n *lintRegexNode) bool { return n.kind == lintGroup && n.hasRepeatedWildcards() }) {
+        problems = append(problems, lintProblem{ 30, "several .* in a row backtrack polynomially" })
+    }
+    largest := 0
+    n.has(func (n *lintRegexNode) bool {
+        if n.kind == lintGroup && len(n.alternatives) > largest {
+            largest = len(n.alternatives)
+        }
+        return false
+    })
+    if largest > lintAlternationBranches {
+        problems = append(problems, lintProblem{ largest / 4, fmt.Sprintf("alternation with %d branches", largest) })
+    }
+    return problems
+}
+
+func requiresMore(nodes []*lintRegexNode) bool {
+    for _, n := range nodes {
+        if n.min >= 1 && n.kind != lintAnchor {
+            return true
+        }
+    }
+    return false
+}
+
+// can some iteration of this group match the same text in more than one way?
+// this is approximated as: one of its alternatives contains an unbounded
+// quantifier, and has no literal character that every iteration must match.
+func (n *lintRegexNode) hasAmbiguousRepetition() bool {
+    if n.group == lintAtomicGroup || n.group == lintLookahead || n.group == lintLookbehind {
+        return false
+    }
+    for _, alternative := range n.alternatives {
+        hasUnbounded, hasSeparator := false, false
+        for _, child := range alternative {
+            if child.min >= 1 && child.isSeparator() {
+                hasSeparator = true
+            }
+            if child.has(func (c *lintRegexNode) bool { return c.unbounded() && c.group != lintAtomicGroup }) {
+                hasUnbounded = true
+            }
+        }
+        if hasUnbounded && !hasSeparator {
+            return true
+        }
+    }
+    return false
+}
+
+// a literal character, or a group where each alternative requires one.
+func (n *lintRegexNode) isSeparator() bool {
+    if n.literal {
+        return true
+    }
+    if n.kind != lintGroup || n.group == lintLookahead || n.group == lintLookbehind {
+        return false
+    }
+    for _, alternative := range n.alternatives {
+        required := false
+        for _, child := range alternative {
+            if child.min >= 1 && child.isSeparator() {
+                required = true
+                break
+            }
+        }
+        if !required {
+            return false
+        }
+    }
+    return true
+}
+
+func (n *lintRegexNode) hasRepeatedWildcards() bool {
+    for _, alternative := range n.alternatives {
+        wildcards := 0
+        for _, child := range alternative {
+            if child.kind == lintAnyCharacter && child.unbounded() {
+                wildcards++
+            }
+        }
+        if wildcards > 1 {
+            return true
+        }
+    }
+    return false
+}
@@ -7,9 +7,9 @@ import (
     "compress/gzip"
     "fmt"
     "io"
-    "io/ioutil"
     "log"
     "net/http"
+    "net/http/httputil"
     "net/url"
     "os"
     "os/signal"
@@ -59,15 +59,25 @@ const archiveSizeLimit = 1_000_000_000 // 1 GB
 // unpacking an archive larger than this limit will fail.
 const uncompressedArchiveSizeLimit = 3_000_000_000 // 3 GB
 
-// files with lines longer than this won't get syntax highlighting.
+// files with lines longer than lineLengthLimit only get reduced-fidelity
+// syntax highlighting (see render.go), and files with lines longer than
+// reducedLineLengthLimit don't get any.
 const lineLengthLimit = 1000
+const reducedLineLengthLimit = 10000
+
+// files above this limit only get reduced-fidelity syntax highlighting.
+const fullHighlightSizeLimit = 2_000_000 // 2 MB
+
+// if highlighting a file with the full grammars takes longer than this, it's
+// started over with the reduced ones.
+const fullHighlightTimeLimit = 10 * time.Second
 
 // the maximum number of "weird" characters above 0xF4 that can appear before a
 // file is considered a binary file.
 const weirdCharacterLimit = 3
 
-// the number of renderer goroutines running at once.
-const numberOfRenderers = 2
+// where the web server listens, unless DEZIP_LISTEN says otherwise.
+const defaultListenAddress = "127.0.0.1:8001"
 
 // the number of archives that can be in a state other than finished or failed.
 const activeArchiveLimit = 4
@@ -76,6 +86,20 @@ const activeArchiveLimit = 4
 // in the archive if they have this name.
 const indexFileName = "hidden.from.dezip.html"
 
+// the name of the json manifest of each archive's directory tree, which is
+// stored next to the root directory's index file.  dezip also ignores files
+// and directories with this name.
+const directoryManifestFileName = "manifest.from.dezip.json"
+
+// renders are written to numbered files in this directory, at the top of the
+// archive's directory, and renamed into place.  dezip also ignores files and
+// directories with this name.
+const renderTemporaryDirectoryName = "rendering.from.dezip"
+
+// archives with more files and directories than this don't get a manifest, so
+// each directory is loaded from the server as a page.
+const directoryManifestNodeLimit = 50000
+
 // how many seconds before a search times out?
 const searchTimeoutSeconds = 20
 
@@ -101,7 +125,10 @@ var globalMutex sync.Mutex
 var activeArchives int
 
 type cache struct {
-    mutex sync.Mutex
+    // protects archivesByURL and archiveURLsToReclaim.  every request looks up
+    // its archive, but archives are only added and removed occasionally, so
+    // lookups just take the read lock.
+    mutex sync.RWMutex
 
     rootPath string
     metaPath string
@@ -111,11 +138,58 @@ type cache struct {
     // archives in the order they will be reclaimed (at the time of writing,
     // this is in creation order).
     archiveURLsToReclaim []string
-    renderingArchiveURLs []string
-    renderingCond *sync.Cond
+
+    // the renderers wait on renderQueuesCond for archives to be added to
+    // renderQueues.  this has its own mutex so renderers looking for work
+    // don't hold up requests.
+    renderQueuesMutex sync.Mutex
+    renderQueues []*renderQueue
+    renderQueuesCond *sync.Cond
+
+    // the other nodes sharing the cache, if any.  see peers.go.
+    peers *peers
+
+    // decides how many renderers run at once.  see renderers.go.  nil when
+    // ingesting, which just uses every core.
+    renderers *renderController
+
+    // the most requested pages.  see hotpages.go.
+    hotPages *hotPageCache
+
+    // restarts (see restart.go).  protected by mutex.  successor is set
+    // while a successor is starting, and handedOff once it has taken over;
+    // from then on, new archives are left to it.  predecessorArchives maps the
+    // urls of the archives a predecessor is still working on to their paths,
+    // and is nil once the predecessor has exited.
+    successor *successor
+    handedOff bool
+    predecessorArchives map[string]string
+    predecessorProxy *httputil.ReverseProxy
 }
 
 func main() {
+    if len(os.Args) > 1 && os.Args[1] == renderWorkerCommand {
+        renderWorkerMain()
+        return
+    }
+    if len(os.Args) > 1 && os.Args[1] == lintGrammarsCommand {
+        if err := lintGrammars(os.Args[2:]); err != nil {
+            log.Fatal(err)
+        }
+        return
+    }
+    if len(os.Args) > 1 && os.Args[1] == fuzzGrammarsCommand {
+        if err := fuzzGrammars(os.Args[2:]); err != nil {
+            log.Fatal(err)
+        }
+        return
+    }
+    if len(os.Args) > 1 && os.Args[1] == compileGrammarsCommand {
+        if err := compileGrammars(os.Args[2:]); err != nil {
+            log.Fatal(err)
+        }
+        return
+    }
     var err error
     alphanum, err = regexp.Compile("[^a-zA-Z0-9]")
     if err != nil {
@@ -145,6 +219,57 @@ func main() {
     closedChannel = make(chan struct{})
     close(closedChannel)
 
+    c := newCache()
+
+    if len(os.Args) > 1 && os.Args[1] == ingestCommand {
+        if err := c.ingest(os.Args[2:]); err != nil {
+            log.Fatal(err)
+        }
+        return
+    }
+
+    // start the renderer goroutines, each with its own worker process.
+    if err := c.startRenderers(); err != nil {
+        log.Fatal(err)
+    }
+
+    listenAddress := defaultListenAddress
+    if address, ok := os.LookupEnv("DEZIP_LISTEN"); ok {
+        listenAddress = address
+    }
+    listener, err := listen(listenAddress)
+    if err != nil {
+        log.Fatal(err)
+    }
+    c.peers, err = newPeers(listenAddress, c)
+    if err != nil {
+        log.Fatal(err)
+    }
+    if c.peers != nil {
+        c.peers.changed = c.reclaimArchivesOwnedByPeers
+        c.reclaimArchivesOwnedByPeers()
+        go c.peers.checkLoop()
+    }
+
+    if err := c.takeOverFromPredecessor(); err != nil {
+        log.Fatal(err)
+    }
+
+    // start the reclamation goroutine.
+    go c.reclaimLoop()
+
+    // start the web server.
+    server := &http.Server{ Handler: c }
+    go c.handleSignals(server, listener)
+    if err := server.Serve(listener); err != http.ErrServerClosed {
+        log.Fatal(err)
+    }
+    // the server was shut down by a signal or a restart, which exits once
+    // it's done.
+    select {}
+}
+
+func newCache() *cache {
     workingDirectory, err := os.Getwd()
     if err != nil {
         log.Fatal(err)
@@ -153,11 +278,12 @@ func main() {
         rootPath: path.Join(workingDirectory, "root"),
         textPath: path.Join(workingDirectory, "text"),
         metaPath: path.Join(workingDirectory, "meta"),
+        hotPages: newHotPageCache(),
     }
-    c.renderingCond = sync.NewCond(&c.mutex)
+    c.renderQueuesCond = sync.NewCond(&c.renderQueuesMutex)
 
     // decode existing archive metadata.
-    c.archivesByURL, err = loadArchivesFromMetadata(c.metaPath)
+    c.archivesByURL, err = loadArchivesFromMetadata(c.metaPath, os.Getenv(predecessorEnv) == "")
     if err != nil {
         log.Fatal(err)
     }
@@ -172,46 +298,32 @@ func main() {
     for _, v := range a {
         c.archiveURLsToReclaim = append(c.archiveURLsToReclaim, v.url)
     }
+    return c
+}
 
-    // find tmlanguage files.
-    var languages []string
-    if syntaxEnv, ok := os.LookupEnv("DEZIP_SYNTAX"); ok {
-        files, err := ioutil.ReadDir(syntaxEnv)
-        if err != nil {
-            log.Fatal(err)
-        }
-        for _, file := range files {
-            languages = append(languages, path.Join(syntaxEnv, file.Name()))
-        }
-    }
-
-    // start the renderer goroutines.
-    for i := 0; i < numberOfRenderers; i++ {
-        go newRenderer(languages).renderLoop(c)
-    }
-
-    // start the reclamation goroutine.
-    go c.reclaimLoop()
+func (c *cache) reclaimUnfinishedArchivesOnExit() {
+    // on exit, reclaim all unfinished archives.
+    signals := make(chan os.Signal, 1)
+    signal.Notify(signals, syscall.SIGINT, syscall.SIGTERM)
+    <-signals
+    c.reclaimUnfinishedArchives()
+    os.Exit(0)
+}
 
-    go func () {
-        // on exit, reclaim all unfinished archives.
-        signals := make(chan os.Signal, 1)
-        signal.Notify(signals, syscall.SIGINT, syscall.SIGTERM)
-        <-signals
-        c.mutex.Lock()
-        for url, ar := range c.archivesByURL {
-            c.mutex.Unlock()
-            ar.mutex.Lock()
-            if ar.state != archiveStateFinished {
-                ar.mutex.Unlock()
-                c.reclaim(url)
-            }
-            c.mutex.Lock()
+func (c *cache) reclaimUnfinishedArchives() {
+    c.mutex.Lock()
+    for url, ar := range c.archivesByURL {
+        c.mutex.Unlock()
+        ar.mutex.Lock()
+        if ar.state != archiveStateFinished {
+            ar.mutex.Unlock()
+            c.reclaim(url)
+        } else {
+            ar.mutex.Unlock()
         }
-        os.Exit(0)
-    }()
-    // start the web server.
-    log.Fatal(http.ListenAndServe("127.0.0.1:8001", c))
+        c.mutex.Lock()
+    }
+    c.mutex.Unlock()
 }
 
 func (c *cache) ServeHTTP(response http.ResponseWriter, request *http.Request) {
@@ -220,6 +332,10 @@ func (c *cache) ServeHTTP(response http.ResponseWriter, request *http.Request) {
         fmt.Fprint(response, "404 invalid url")
         return
     }
+    if request.URL.Path == peerCheckPath {
+        fmt.Fprint(response, "ok")
+        return
+    }
     if request.URL.Path == "/" {
         response.Header().Add("Location", rewriteURLv1(strings.Split("/" + thisArchive, "/")) + "dezip/README.md")
         response.WriteHeader(302)
@@ -279,12 +395,25 @@ func (c *cache) ServeHTTP(response http.ResponseWriter, request *http.Request) {
         // construct the url which locates the archive.
         p.archiveURL = fmt.Sprintf("%s://%s", scheme, strings.Join(fetchComponents, "/"))
 
+        // hand the request to the node which owns the archive, unless it came
+        // from another node already.
+        if owner := c.peers.owner(p.archiveURL); owner != nil && !c.peers.forwarded(request) {
+            owner.proxy.ServeHTTP(response, request)
+            return
+        }
+
+        // archives a restarted process is still working on are its to serve.
+        if proxy := c.predecessorFor(p.archiveURL); proxy != nil {
+            proxy.ServeHTTP(response, request)
+            return
+        }
+
         if len(request.URL.Query()["remove"]) > 0 {
             response.Header().Set("Content-Type", "text/html;charset=utf-8")
             if request.Method == "POST" {
-                c.mutex.Lock()
+                c.mutex.RLock()
                 archive := c.archivesByURL[p.archiveURL]
-                c.mutex.Unlock()
+                c.mutex.RUnlock()
                 if archive != nil {
                     archive.mutex.Lock()
                     archive.transitionToState(archiveStateFailed)
@@ -305,17 +434,34 @@ func (c *cache) ServeHTTP(response http.ResponseWriter, request *http.Request) {
 
         // check whether an archive downloaded (or currently downloading) from
         // this url is in the cache.  if not, create a new empty archive.
-        c.mutex.Lock()
+        c.mutex.RLock()
         archive := c.archivesByURL[p.archiveURL]
+        c.mutex.RUnlock()
+        handedOff := false
         if archive == nil {
-            archive = newArchive(strings.Join(archiveComponents, "/"))
-            if archive != nil {
-                c.archivesByURL[p.archiveURL] = archive
-                c.archiveURLsToReclaim = append(c.archiveURLsToReclaim, p.archiveURL)
+            c.mutex.Lock()
+            // check again in case another request created it in the meantime.
+            archive = c.archivesByURL[p.archiveURL]
+            handedOff = c.handedOff
+            if archive == nil && !handedOff {
+                archive = newArchive(strings.Join(archiveComponents, "/"))
+                if archive != nil {
+                    c.archivesByURL[p.archiveURL] = archive
+                    c.archiveURLsToReclaim = append(c.archiveURLsToReclaim, p.archiveURL)
+                }
             }
+            c.mutex.Unlock()
         }
-        c.mutex.Unlock()
 
+        if archive == nil && handedOff {
+            // this process is being restarted, and its successor is taking
+            // new archives.  have the client ask again on a new connection,
+            // which the successor will accept.
+            response.Header().Set("Connection", "close")
+            response.Header().Add("Location", request.URL.RequestURI())
+            response.WriteHeader(302)
+            return
+        }
         if archive == nil {
             response.WriteHeader(503)
             p.writeErrorPage(response, fmt.Errorf("too many concurrent downloads; try again later"))
@@ -324,45 +470,7 @@ func (c *cache) ServeHTTP(response http.ResponseWriter, request *http.Request) {
 
         archive.mutex.Lock()
         if archive.state == archiveStateInitial {
-            var format archiveFormat
-            for extension, fmt := range formats {
-                if strings.HasSuffix(p.archiveURL, extension) {
-                    format = fmt
-                    break
-                }
-            }
-            if format == nil {
-                archive.transitionToState(archiveStateFailed)
-                archive.failureReason = fmt.Errorf("based on its file extension, %v doesn't look like an archive file", fetchComponents[len(fetchComponents)-1])
-            } else {
-                // if the archive is newly initialized, start the download and
-                // transition to the downloading state.
-                archive.transitionToState(archiveStateDownloading)
-                archive.progress.estimatedContentLength = archiveSizeLimit
-                go func () {
-                    defer func () {
-                        if r := recover(); r != nil {
-                            log.Print("recovered in download: ", r, "\n", string(debug.Stack()))
-                            archive.mutex.Lock()
-                            archive.transitionToState(archiveStateFailed)
-                            archive.failureReason = fmt.Errorf("panic during download: %v\n%v", r, string(debug.Stack()))
-                            archive.mutex.Unlock()
-                        }
-                    }()
-                    if err := c.download(p, format, protocol, archive); err != nil {
-                        archive.mutex.Lock()
-                        archive.transitionToState(archiveStateFailed)
-                        archive.failureReason = err
-                        archive.mutex.Unlock()
-                    }
-                    archive.mutex.Lock()
-                    state := archive.state
-                    archive.mutex.Unlock()
-                    if state == archiveStateFailed {
-                        c.reclaimFiles(archive.path)
-                    }
-                }()
-            }
+            c.startDownload(archive, p, protocol)
         }
         timeout := 1 * time.Second
         if len(request.Header["X-Dezip-Progress"]) > 0 {
@@ -379,9 +487,13 @@ func (c *cache) ServeHTTP(response http.ResponseWriter, request *http.Request) {
         }
         searchQuery := request.URL.Query()["search"]
         directorySearch := len(searchQuery) > 0 && p.isDirectory
+        diffQuery := request.URL.Query()["diff"]
+        directoryDiff := len(diffQuery) > 0 && len(diffQuery[0]) > 0 && p.isDirectory && !directorySearch
+        directoryManifest := len(request.URL.Query()["manifest"]) > 0 && p.isDirectory && !directorySearch && !directoryDiff
         var ready chan struct{}
-        if directorySearch {
-            // directory searches require the entire archive to be downloaded.
+        if directorySearch || directoryDiff || directoryManifest {
+            // directory searches, diffs, and manifests require the entire
+            // archive to be downloaded.
             ready = archive.downloaded
         } else {
             // request that the file be rendered.  returns a channel that blocks
@@ -391,6 +503,24 @@ func (c *cache) ServeHTTP(response http.ResponseWriter, request *http.Request) {
         originalState := archive.state
         archive.mutex.Unlock()
 
+        if originalState == archiveStateRendering && !p.isDirectory && len(searchQuery) == 0 && timeout > plainRenderDelay {
+            // if the file isn't rendered right away, show it without syntax
+            // highlighting in the meantime.  the render controller keeps
+            // track of how long people wait.
+            select {
+            case <-ready:
+            default:
+                waitStart := time.Now()
+                select {
+                case <-ready:
+                    c.renderers.observeWait(time.Since(waitStart))
+                case <-time.After(plainRenderDelay):
+                    c.renderers.observeWait(plainRenderDelay)
+                    go c.renderPlainVersion(archive, p.archiveURL, p.name)
+                }
+            }
+        }
+
         // wait a bit for the file to finish rendering.
         select {
         case <-ready:
@@ -403,10 +533,33 @@ func (c *cache) ServeHTTP(response http.ResponseWriter, request *http.Request) {
                 archive.mutex.Lock()
                 dir := archive.initialDirectory
                 archive.mutex.Unlock()
-                response.Header().Add("Location", path.Join(rewrittenPath, dir) + "/")
+                location := path.Join(rewrittenPath, dir) + "/"
+                if len(request.URL.RawQuery) > 0 {
+                    // keep ?diff=... and friends.
+                    location += "?" + request.URL.RawQuery
+                }
+                response.Header().Add("Location", location)
                 response.WriteHeader(302)
                 break
             }
+            if directoryManifest {
+                f, err := os.Open(path.Join(c.rootPath, archive.path, directoryManifestFileName))
+                if err != nil {
+                    // archives rendered before manifests existed, or with
+                    // too many files, don't have one.
+                    response.WriteHeader(404)
+                    fmt.Fprint(response, "404 not found")
+                    break
+                }
+                defer f.Close()
+                response.Header().Set("Content-Type", "application/json")
+                io.Copy(response, f)
+                break
+            }
+            plainPage := !directorySearch && !directoryDiff && len(searchQuery) == 0
+            if plainPage && c.hotPages.serve(response, request, request.URL.Path, archive) {
+                break
+            }
             var filename string
             var info os.FileInfo
             if len(searchQuery) > 0 {
@@ -448,11 +601,33 @@ func (c *cache) ServeHTTP(response http.ResponseWriter, request *http.Request) {
                         }
                     }
                 }
+                // later pages of results pick up where the previous page
+                // left off.
+                var from searchPosition
+                from.candidate, _ = strconv.Atoi(request.URL.Query().Get("from"))
+                from.match, _ = strconv.Atoi(request.URL.Query().Get("match"))
+                if from.candidate < 0 || from.match < 0 {
+                    from = searchPosition{}
+                }
                 results := make(chan searchResult, 5)
-                go c.search(archive, searchQuery[0], filter, results)
-                p.writeSearchResultsPage(response, searchQuery[0], filter, results)
+                go c.search(archive, searchQuery[0], filter, from, results)
+                p.writeSearchResultsPage(response, searchQuery[0], filter, from, results)
+            } else if directoryDiff {
+                results := make(chan diffResult, 5)
+                go c.diff(archive, diffQuery[0], results)
+                p.writeDiffPage(response, diffQuery[0], results)
             } else if len(searchQuery) > 0 {
                 insertSearchAnchors(response, f, searchQuery[0])
+            } else if info, err := f.Stat(); err == nil && plainPage {
+                if body, err := c.hotPages.admit(request.URL.Path, archive, f, info.Size()); err != nil {
+                    log.Printf("reading %s: %v", request.URL.Path, err)
+                    response.WriteHeader(500)
+                    p.writeErrorPage(response, err)
+                } else if body != nil {
+                    response.Write(body)
+                } else {
+                    io.Copy(response, f)
+                }
             } else {
                 io.Copy(response, f)
             }
@@ -462,7 +637,7 @@ func (c *cache) ServeHTTP(response http.ResponseWriter, request *http.Request) {
             archive.mutex.Lock()
             state := archive.state
             reason := archive.failureReason
-            progress := archive.progress
+            progress := archive.progressSnapshot()
             archive.mutex.Unlock()
             switch state {
             case archiveStateDownloading:
@@ -500,6 +675,48 @@ func (c *cache) ServeHTTP(response http.ResponseWriter, request *http.Request) {
     }
 }
 
+// if the archive is newly initialized, start the download and transition to
+// the downloading state.  call with ar.mutex held.
+func (c *cache) startDownload(ar *archive, p page, protocol protocol) {
+    var format archiveFormat
+    for extension, fmt := range formats {
+        if strings.HasSuffix(p.archiveURL, extension) {
+            format = fmt
+            break
+        }
+    }
+    if format == nil {
+        ar.transitionToState(archiveStateFailed)
+        ar.failureReason = fmt.Errorf("based on its file extension, %v doesn't look like an archive file", path.Base(p.archiveURL))
+        return
+    }
+    ar.transitionToState(archiveStateDownloading)
+    ar.progress.estimatedContentLength = archiveSizeLimit
+    go func () {
+        defer func () {
+            if r := recover(); r != nil {
+                log.Print("recovered in download: ", r, "\n", string(debug.Stack()))
+                ar.mutex.Lock()
+                ar.transitionToState(archiveStateFailed)
+                ar.failureReason = fmt.Errorf("panic during download: %v\n%v", r, string(debug.Stack()))
+                ar.mutex.Unlock()
+            }
+        }()
+        if err := c.download(p, format, protocol, ar); err != nil {
+            ar.mutex.Lock()
+            ar.transitionToState(archiveStateFailed)
+            ar.failureReason = err
+            ar.mutex.Unlock()
+        }
+        ar.mutex.Lock()
+        state := ar.state
+        ar.mutex.Unlock()
+        if state == archiveStateFailed {
+            c.reclaimFiles(ar.path)
+        }
+    }()
+}
+
 func rewriteURLv1(components []string) string {
     // rewrite urls of the form dezip.org/scheme://....
     // make sure to handle the case where scheme://... becomes scheme:/... due
@@ -512,6 +729,13 @@ func rewriteURLv1(components []string) string {
     return fmt.Sprintf("/v1/%d/%s/%s/", len(path) + 4, scheme[:len(scheme)-1], strings.Join(path, "/"))
 }
 
+func min(a, b int) int {
+    if a < b {
+        return a
+    }
+    return b
+}
+
 // -- archive formats
 
 type archiveFormat interface {
@@ -0,0 +1,96 @@
+package main
+
+import (
+    "sync"
+)
+
+// analyzing and rendering a file both hold copies of its contents in memory,
+// so a few large files processed at once can use a lot of it.  before working
+// on a file, reserve an estimate of the memory it will need from this budget.
+const memoryBudget = 2_000_000_000 // 2 GB
+
+// how many bytes does each stage need per byte of file?  (analysis holds a
+// file's compressed and uncompressed contents, which are sized exactly; see
+// extract.go.)  rendering text reads the file, copies it for oniguruma, and
+// holds the highlighted output in flight; markdown also builds goldmark's
+// syntax tree.
+const textRenderMemoryFactor = 4
+const markdownRenderMemoryFactor = 8
+
+// renders needing more than 1/largeRenderFraction of the budget are deferred
+// to the end of their archive if they don't fit right away, rather than
+// holding up the smaller files behind them.
+const largeRenderFraction = 8
+
+var memory = newMemoryGate(memoryBudget)
+
+type memoryGate struct {
+    mutex sync.Mutex
+    cond *sync.Cond
+    available int64
+    total int64
+}
+
+func newMemoryGate(total int64) *memoryGate {
+    m := &memoryGate{ available: total, total: total }
+    m.cond = sync.NewCond(&m.mutex)
+    return m
+}
+
+// requests larger than the whole budget are treated as needing all of it, so
+// they run alone instead of waiting forever.
+func (m *memoryGate) clamp(n int64) int64 {
+    if n < 0 {
+        return 0
+    }
+    if n > m.total {
+        return m.total
+    }
+    return n
+}
+
+// returns the number of bytes reserved, which should be passed to release().
+func (m *memoryGate) reserve(n int64) int64 {
+    n = m.clamp(n)
+    m.mutex.Lock()
+    for m.available < n {
+        m.cond.Wait()
+    }
+    m.available -= n
+    m.mutex.Unlock()
+    return n
+}
+
+// like reserve(), but returns false instead of waiting.
+func (m *memoryGate) tryReserve(n int64) (int64, bool) {
+    n = m.clamp(n)
+    m.mutex.Lock()
+    defer m.mutex.Unlock()
+    if m.available < n {
+        return 0, false
+    }
+    m.available -= n
+    return n, true
+}
+
+func (m *memoryGate) release(n int64) {
+    if n == 0 {
+        return
+    }
+    m.mutex.Lock()
+    m.available += n
+    m.cond.Broadcast()
+    m.mutex.Unlock()
+}
+
+func renderMemoryEstimate(entry *archiveDirectoryEntry) int64 {
+    size := int64(entry.file.UncompressedSize64)
+    if size > textFileSizeLimit || entry.lines < 0 {
+        // the contents aren't read at all.
+        return 0
+    }
+    if defaultContentType(entry) == contentTypeMarkdown {
+        return size * markdownRenderMemoryFactor
+    }
+    return size * textRenderMemoryFactor
+}
@@ -1,15 +1,18 @@
 package main
 
 import (
+    "encoding/json"
+    "errors"
     "html"
     "io"
     "io/ioutil"
-    "fmt"
     "log"
     "net/url"
     "os"
     "path"
+    "strconv"
     "strings"
+    "sync"
     "time"
 
     "github.com/yuin/goldmark"
@@ -30,214 +33,341 @@ const (
     contentTypeMarkdown
 )
 
-func (p page) writeDirectoryPage(w io.Writer, dirs map[string]*archiveDirectory) {
-    p.writePrologue(w)
-    p.writeHeader(w, headerOptions{})
-    fmt.Fprintln(w, "    <div class='directory-container'>")
-    fmt.Fprintln(w, "      <table class='directory'>")
-    fmt.Fprintln(w, "        <colgroup>")
-    fmt.Fprintln(w, "          <col span='1'>")
-    fmt.Fprintln(w, "          <col span='1' width='*'>")
-    fmt.Fprintln(w, "          <col span='1' width='80px'>")
-    fmt.Fprintln(w, "          <col span='1' class='size-column'>")
-    fmt.Fprintln(w, "          <col span='1' class='mod-date-column'>")
-    fmt.Fprintln(w, "        </colgroup>")
-    dir := dirs[p.name]
-    fmt.Fprint(w, "        <tr class='back'><td>&nbsp;</td><td class='filename' colspan='4'>")
+const directoryTableBegin = "    <div class='directory-container'>\n" +
+    "      <table class='directory'>\n" +
+    "        <colgroup>\n" +
+    "          <col span='1'>\n" +
+    "          <col span='1' width='*'>\n" +
+    "          <col span='1' width='80px'>\n" +
+    "          <col span='1' class='size-column'>\n" +
+    "          <col span='1' class='mod-date-column'>\n" +
+    "        </colgroup>\n"
+const directoryTableEnd = "      </table>\n" +
+    "    </div>\n"
+const emptyDirectoryRow = "        <tr><td>&nbsp;</td><td colspan='4'><div class='empty'>empty directory</div></td></tr>\n"
+const emptyCell = "<td class='light'>&mdash;</td>"
+
+func (p page) writeDirectoryPage(w io.Writer, tree *directoryTree, id int32) {
+    b := newPageBuffer(w)
+    defer b.release()
+    p.writePrologue(b)
+    p.writeHeader(b, headerOptions{})
+    b.str(directoryTableBegin)
+    dir := &tree.nodes[id]
+    b.str("        <tr class='back'><td>&nbsp;</td><td class='filename' colspan='4'>")
     parentLinkClass := ""
-    if len(dir.fileNames) > 0 && len(dir.directoryNames) == 0 {
+    if dir.numberOfFiles > 0 && dir.numberOfSubdirectories == 0 {
         parentLinkClass = " class='adjust-for-dblborder'"
     }
     if len(p.name) > 0 {
-        fmt.Fprint(w, "<a href='..'", parentLinkClass, ">..</a>")
+        b.str("<a href='..'")
+        b.str(parentLinkClass)
+        b.str(">..</a>")
     } else {
-        fmt.Fprint(w, "<a", parentLinkClass, ">&nbsp;</a>")
+        b.str("<a")
+        b.str(parentLinkClass)
+        b.str(">&nbsp;</a>")
     }
-    fmt.Fprintln(w, "</td></tr>")
-    if len(dir.fileNames) + len(dir.directoryNames) == 0 {
-        fmt.Fprintln(w, "        <tr><td>&nbsp;</td><td colspan='4'><div class='empty'>empty directory</div></td></tr>")
+    b.str("</td></tr>\n")
+    if dir.numberOfChildren == 0 {
+        b.str(emptyDirectoryRow)
     }
-    for i, name := range dir.directoryNames {
-        fmt.Fprint(w, "        <tr>")
+    for i, subdirID := range tree.subdirectories(id) {
+        b.str("        <tr>")
         if i == 0 {
-            fmt.Fprint(w, "<td class='category'>directories</td>")
+            b.str("<td class='category'>directories</td>")
         } else {
-            fmt.Fprint(w, "<td>&nbsp;</td>")
+            b.str("<td>&nbsp;</td>")
         }
-        entry := dir.entries[name]
-        // look up the subdirectory entry to see how many files and directories
-        // it contains.
-        subdir := dirs[path.Join(p.name, name)]
+        subdir := &tree.nodes[subdirID]
+        modified := subdir.modified
+        name := subdir.name
         prefix := ""
         // while there's only a single subdirectory, add the intermediate
         // directory to a prefix and continue.
-        for len(subdir.directoryNames) == 1 && len(subdir.fileNames) == 0 {
+        for subdir.numberOfSubdirectories == 1 && subdir.numberOfFiles == 0 {
             prefix = path.Join(prefix, name)
-            name = subdir.directoryNames[0]
-            subdir = dirs[path.Join(p.name, prefix, name)]
+            subdir = &tree.nodes[tree.subdirectories(subdirID)[0]]
+            subdirID = tree.subdirectories(subdirID)[0]
+            name = subdir.name
         }
-        fmt.Fprint(w, "<td class='filename'>");
+        b.str("<td class='filename'><a href='./")
         if len(prefix) > 0 {
-            fmt.Fprintf(w, "<a href='./%s/%s/'><span class='prefix'>%s/</span>%s</a></td>", html.EscapeString(escapeURLPath(prefix)), html.EscapeString(escapeURLPath(name)), html.EscapeString(prefix), html.EscapeString(name))
+            b.escaped(escapeURLPath(prefix))
+            b.str("/")
+            b.escaped(escapeURLPath(name))
+            b.str("/'><span class='prefix'>")
+            b.escaped(prefix)
+            b.str("/</span>")
         } else {
-            fmt.Fprintf(w, "<a href='./%s/'>%s</a></td>", html.EscapeString(escapeURLPath(name)), html.EscapeString(name))
+            b.escaped(escapeURLPath(name))
+            b.str("/'>")
         }
-        if len(subdir.fileNames) > 0 {
-            fs := "file"; if len(subdir.fileNames) != 1 { fs = "files" }
-            fmt.Fprintf(w, "<td>%d %s</td>", len(subdir.fileNames), fs)
+        b.escaped(name)
+        b.str("</a></td>")
+        if subdir.numberOfFiles > 0 {
+            b.str("<td>")
+            b.int(int(subdir.numberOfFiles))
+            if subdir.numberOfFiles != 1 {
+                b.str(" files</td>")
+            } else {
+                b.str(" file</td>")
+            }
         } else {
-            fmt.Fprint(w, "<td class='light'>&mdash;</td>")
+            b.str(emptyCell)
         }
-        if len(subdir.directoryNames) == 1 {
-            fmt.Fprint(w, "<td>1 <span class='abbr abbr-subdirectory'><span>subdirectory</span></span></td>")
-        } else if len(subdir.directoryNames) > 1 {
-            fmt.Fprintf(w, "<td>%d <span class='abbr abbr-subdirectories'><span>subdirectories</span></span></td>", len(subdir.directoryNames))
+        if subdir.numberOfSubdirectories == 1 {
+            b.str("<td>1 <span class='abbr abbr-subdirectory'><span>subdirectory</span></span></td>")
+        } else if subdir.numberOfSubdirectories > 1 {
+            b.str("<td>")
+            b.int(int(subdir.numberOfSubdirectories))
+            b.str(" <span class='abbr abbr-subdirectories'><span>subdirectories</span></span></td>")
         } else {
-            fmt.Fprint(w, "<td class='light'>&mdash;</td>")
+            b.str(emptyCell)
         }
-        fmt.Fprintf(w, "<td>%s</td>", formatTime(entry.modified))
-        fmt.Fprintln(w, "</tr>")
+        b.str("<td>")
+        b.time(modified)
+        b.str("</td></tr>\n")
     }
-    for i, name := range dir.fileNames {
+    for i, fileID := range tree.files(id) {
         if i == 0 {
-            fmt.Fprint(w, "        <tr class='dblborder'><td class='category'>files</td>")
+            b.str("        <tr class='dblborder'><td class='category'>files</td>")
         } else {
-            fmt.Fprint(w, "        <tr><td>&nbsp;</td>")
+            b.str("        <tr><td>&nbsp;</td>")
         }
-        entry := dir.entries[name]
+        name := tree.nodes[fileID].name
+        entry := tree.nodes[fileID].entry
         mode := entry.file.Mode()
-        fmt.Fprint(w, "<td class='filename'>")
+        b.str("<td class='filename'>")
         if mode & os.ModeSymlink != 0 {
-            fmt.Fprint(w, "<div>")
+            b.str("<div>")
         }
-        fmt.Fprintf(w, "<a href='./%s'>%s</a>", html.EscapeString(escapeURLPath(name)), html.EscapeString(name))
+        b.str("<a href='./")
+        b.escaped(escapeURLPath(name))
+        b.str("'>")
+        b.escaped(name)
+        b.str("</a>")
         if mode & os.ModeSymlink != 0 {
-            fmt.Fprint(w, " &#x2192; ")
-            rc, err := entry.file.Open()
-            if err == nil {
-                bytes, err := ioutil.ReadAll(rc)
-                if err == nil {
-                    link := path.Clean(string(bytes))
-                    fmt.Fprintf(w, "<a href='./%s'>", html.EscapeString(escapeURLPath(link)))
-                    slash := strings.LastIndex(link, "/")
-                    if slash >= 0 && slash+1 < len(link) {
-                        fmt.Fprint(w, "<span class='prefix'>")
-                        fmt.Fprint(w, html.EscapeString(link[:slash+1]))
-                        fmt.Fprint(w, "</span>")
-                        fmt.Fprint(w, html.EscapeString(link[slash+1:]))
-                    } else {
-                        fmt.Fprint(w, html.EscapeString(link))
-                    }
-                    fmt.Fprint(w, "</a>")
+            b.str(" &#x2192; ")
+            if link, err := symlinkTarget(entry); err == nil {
+                b.str("<a href='./")
+                b.escaped(escapeURLPath(link))
+                b.str("'>")
+                slash := strings.LastIndex(link, "/")
+                if slash >= 0 && slash+1 < len(link) {
+                    b.str("<span class='prefix'>")
+                    b.escaped(link[:slash+1])
+                    b.str("</span>")
+                    b.escaped(link[slash+1:])
+                } else {
+                    b.escaped(link)
                 }
-                rc.Close()
+                b.str("</a>")
             }
-            fmt.Fprint(w, "</div>")
-        }        
-        fmt.Fprintf(w, "</td>")
+            b.str("</div>")
+        }
+        b.str("</td>")
         lines := entry.lines
         if lines >= 0 {
-            ls := "line"; if lines != 1 { ls = "lines" }
-            fmt.Fprintf(w, "<td>%d %s</td>", lines, ls)
+            b.str("<td>")
+            b.int(lines)
+            if lines != 1 {
+                b.str(" lines</td>")
+            } else {
+                b.str(" line</td>")
+            }
         } else {
-            fmt.Fprintf(w, "<td class='light'>&mdash;</td>")
+            b.str(emptyCell)
         }
+        b.str("<td>")
         size := float64(entry.file.UncompressedSize64)
         if size >= 10_000_000 {
-            fmt.Fprintf(w, "<td>%.0f MB</td>", size / 1_000_000)
+            b.float(size / 1_000_000, 0)
+            b.str(" MB")
         } else if size >= 700_000 {
-            fmt.Fprintf(w, "<td>%.1f MB</td>", size / 1_000_000)
+            b.float(size / 1_000_000, 1)
+            b.str(" MB")
         } else if size >= 10_000 {
-            fmt.Fprintf(w, "<td>%.0f KB</td>", size / 1000)
+            b.float(size / 1000, 0)
+            b.str(" KB")
         } else if size >= 700 {
-            fmt.Fprintf(w, "<td>%.1f KB</td>", size / 1000)
+            b.float(size / 1000, 1)
+            b.str(" KB")
         } else {
-            bs := "byte"; if size != 1 { bs = "bytes" }
-            fmt.Fprintf(w, "<td>%.0f %s</td>", size, bs)
-        }
-        fmt.Fprintf(w, "<td>%s</td>", formatTime(entry.modified))
-        fmt.Fprintln(w, "</tr>")
-    }
-    if len(dir.readmeName) > 0 {
-        fmt.Fprintln(w, "        <tr class='border'>")
-        fmt.Fprintln(w, "          <td class='category' valign='top'>README</td><td colspan='4' class='readme'><div class='readme-container'>");
-        p.writeFileContents(w, nil, dir.entries[dir.readmeName], defaultContentType(dir.entries[dir.readmeName]))
-        fmt.Fprintln(w, "          </div></td>");
-        fmt.Fprintln(w, "        </tr>")
-    }
-    fmt.Fprintln(w, "      </table>")
-    fmt.Fprintln(w, "    </div>")
-    p.writeEpilogue(w)
-}
-
-func (p page) writeFilePage(w io.Writer, h *tm.Highlighter, entry *archiveDirectoryEntry, contentType contentType) {
-    p.writePrologue(w)
-    p.writeHeader(w, headerOptions{})
-    fmt.Fprintln(w, "    <table class='file'>")
-    fmt.Fprintln(w, "      <colgroup><col span='1' class='line-numbers-column'><col span='1' width='*'></colgroup>")
-    fmt.Fprintln(w, "      <tr class='directory back'><td>&nbsp;</td><td class='filename'><a href='.'>..</a></td></tr>")
-    fmt.Fprint(w, "      <tr class='fileborder'>")
+            b.float(size, 0)
+            if size != 1 {
+                b.str(" bytes")
+            } else {
+                b.str(" byte")
+            }
+        }
+        b.str("</td><td>")
+        b.time(entry.modified)
+        b.str("</td></tr>\n")
+    }
+    if dir.readme != noDirectoryNode {
+        b.str("        <tr class='border'>\n")
+        b.str("          <td class='category' valign='top'>README</td><td colspan='4' class='readme'><div class='readme-container'>\n")
+        readme := tree.nodes[dir.readme].entry
+        p.writeFileContents(b, nil, time.Time{}, readme, defaultContentType(readme))
+        b.str("          </div></td>\n")
+        b.str("        </tr>\n")
+    }
+    b.str(directoryTableEnd)
+    p.writeEpilogue(b)
+}
+
+func symlinkTarget(entry *archiveDirectoryEntry) (string, error) {
+    rc, err := entry.file.Open()
+    if err != nil {
+        return "", err
+    }
+    defer rc.Close()
+    bytes, err := ioutil.ReadAll(rc)
+    if err != nil {
+        return "", err
+    }
+    return path.Clean(string(bytes)), nil
+}
+
+// -- directory manifests
+
+// the directory tree of an archive as json, so dezip.js can show directories
+// without loading a page from the server for each one.  it has everything
+// writeDirectoryPage() shows except readme contents, which dezip.js loads
+// from the readme's own page.  directories have children (c) and files
+// don't.  keys are short and zero values are left out to keep it small.
+type directoryManifest struct {
+    ArchiveURL string `json:"url"`
+    Root *directoryManifestNode `json:"root"`
+}
+
+type directoryManifestNode struct {
+    Name string `json:"n,omitempty"`
+    Modified string `json:"m"`
+    Size uint64 `json:"s,omitempty"`
+    Lines int `json:"l,omitempty"`
+    Link string `json:"k,omitempty"`
+    Readme string `json:"r,omitempty"`
+    Children *[]*directoryManifestNode `json:"c,omitempty"`
+}
+
+const directoryManifestDateLayout = "2006-01-02"
+
+func (p page) writeDirectoryManifest(w io.Writer, tree *directoryTree) error {
+    var node func (id int32) *directoryManifestNode
+    node = func (id int32) *directoryManifestNode {
+        n := &tree.nodes[id]
+        m := &directoryManifestNode{
+            Name: n.name,
+            Modified: n.modified.Format(directoryManifestDateLayout),
+        }
+        if !n.isDirectory {
+            m.Size = n.entry.file.UncompressedSize64
+            m.Lines = n.entry.lines
+            if n.entry.file.Mode() & os.ModeSymlink != 0 {
+                m.Link, _ = symlinkTarget(n.entry)
+            }
+            return m
+        }
+        if n.readme != noDirectoryNode {
+            m.Readme = tree.nodes[n.readme].name
+        }
+        children := make([]*directoryManifestNode, 0, n.numberOfChildren)
+        for _, child := range tree.childrenOf(id) {
+            children = append(children, node(child))
+        }
+        m.Children = &children
+        return m
+    }
+    return json.NewEncoder(w).Encode(directoryManifest{
+        ArchiveURL: p.archiveURL,
+        Root: node(rootDirectoryNode),
+    })
+}
+
+const fileTableBegin = "    <table class='file'>\n" +
+    "      <colgroup><col span='1' class='line-numbers-column'><col span='1' width='*'></colgroup>\n" +
+    "      <tr class='directory back'><td>&nbsp;</td><td class='filename'><a href='.'>..</a></td></tr>\n" +
+    "      <tr class='fileborder'>"
+const fileTableEnd = "</tr>\n" +
+    "    </table>\n"
+
+// if highlighting takes until deadline (unless it's zero), gives up and
+// returns errHighlightTooSlow.  the page is left unfinished.
+func (p page) writeFilePage(w io.Writer, h *tm.Highlighter, deadline time.Time, entry *archiveDirectoryEntry, contentType contentType) error {
+    b := newPageBuffer(w)
+    defer b.release()
+    p.writePrologue(b)
+    p.writeHeader(b, headerOptions{})
+    b.str(fileTableBegin)
     if entry.file.UncompressedSize64 > textFileSizeLimit {
-        fmt.Fprint(w, "<td>&nbsp;</td><td><div class='empty'>file is too big to render</div></td>")
+        b.str("<td>&nbsp;</td><td><div class='empty'>file is too big to render</div></td>")
     } else {
         if contentType == contentTypeMarkdown {
-            fmt.Fprint(w, "<td>&nbsp;</td><td>")
+            b.str("<td>&nbsp;</td><td>")
         } else {
-            p.writeLineNumbers(w, 1, entry.lines)
-            fmt.Fprint(w, "<td valign='top'>")
+            p.writeLineNumbers(b, 1, entry.lines)
+            b.str("<td valign='top'>")
+        }
+        if err := p.writeFileContents(b, h, deadline, entry, contentType); err == errHighlightTooSlow {
+            return err
         }
-        p.writeFileContents(w, h, entry, contentType)
-        fmt.Fprint(w, "</td>")
+        b.str("</td>")
     }
-    fmt.Fprintln(w, "</tr>")
-    fmt.Fprintln(w, "    </table>")
-    p.writeEpilogue(w)
+    b.str(fileTableEnd)
+    p.writeEpilogue(b)
+    return nil
 }
 
-func (p page) writeFileContents(w io.Writer, h *tm.Highlighter, entry *archiveDirectoryEntry, contentType contentType) {
+// returns errHighlightTooSlow if highlighting reaches deadline.  other errors
+// are written into the page.
+func (p page) writeFileContents(b *pageBuffer, h *tm.Highlighter, deadline time.Time, entry *archiveDirectoryEntry, contentType contentType) error {
     if entry.lines < 0 {
-        fmt.Fprintln(w, "<div class='empty'>binary file</div>")
-        return
+        b.str("<div class='empty'>binary file</div>\n")
+        return nil
     } else if entry.file.UncompressedSize64 == 0 {
-        fmt.Fprintln(w, "<div class='empty'>empty file</div>")
-        return
+        b.str("<div class='empty'>empty file</div>\n")
+        return nil
     }
     rc, err := entry.file.Open()
     if err != nil {
         log.Print(err)
-        return
+        return nil
     }
     defer rc.Close()
     if contentType == contentTypeMarkdown {
-        fmt.Fprintln(w, "<div class='markdown'>")
+        b.str("<div class='markdown'>\n")
         bytes, err := ioutil.ReadAll(rc)
         if err == nil {
             md := goldmark.New(goldmark.WithExtensions(extension.GFM))
-            if err := md.Convert(bytes, w); err != nil {
+            if err := md.Convert(bytes, b); err != nil {
                 log.Print(err)
             }
         } else {
             log.Print(err)
         }
-        fmt.Fprintln(w, "</div>")
+        b.str("</div>\n")
     } else {
-        fmt.Fprintln(w, "<pre class='code file-contents'>");
-        fmt.Fprint(w, beginSearchMarker)
-        if h == nil || entry.maximumLineLength > lineLengthLimit {
-            buf := &strings.Builder{}
-            io.Copy(buf, rc)
-            fmt.Fprint(w, html.EscapeString(buf.String()))
+        b.str("<pre class='code file-contents'>\n")
+        b.str(beginSearchMarker)
+        buf, err := ioutil.ReadAll(rc)
+        if err != nil {
+            b.str("error: ")
+            b.escaped(err.Error())
+        } else if h == nil {
+            b.escapedBytes(buf)
         } else {
-            buf, err := ioutil.ReadAll(rc)
-            if err != nil {
-                fmt.Fprint(w, "error: ", html.EscapeString(err.Error()))
-            } else {
-                h.Highlight(highlightWriter{w}, buf, entry.file.Name)
+            w := &highlightWriter{ b: b, deadline: deadline }
+            if err := h.Highlight(w, buf, entry.file.Name); err == errHighlightTooSlow {
+                return err
             }
+            w.flush()
         }
-        fmt.Fprint(w, endSearchMarker)
-        fmt.Fprintln(w, "</pre>");
+        b.str(endSearchMarker)
+        b.str("</pre>\n")
     }
+    return nil
 }
 
 type highlightScope struct {
@@ -273,37 +403,71 @@ func highlightScopeForScopeName(scope string) interface{} {
         return nil
     }
 }
+var errHighlightTooSlow = errors.New("highlighting took too long")
+
+// the highlighter ends every scope at the end of each line, and begins the
+// ones that continue again at the start of the next.  rather than closing
+// and reopening their elements, a scope's end tags are held back until
+// something other than a newline or the same scope beginning again comes
+// along, so a 500-line block comment is one element instead of 500.  search
+// results and diffs, which show lines out of context, reopen the elements a
+// line starts inside of (see tagStack).
 type highlightWriter struct {
-    w io.Writer
+    b *pageBuffer
+    deadline time.Time
+    // scopes which have ended, but whose end tags haven't been written yet,
+    // innermost first.
+    ended []highlightScope
 }
-func (w highlightWriter) Write(bytes []byte) (int, error) {
-    _, err := fmt.Fprint(w.w, html.EscapeString(string(bytes)))
-    return len(bytes), err
+func (w *highlightWriter) Write(bytes []byte) (int, error) {
+    w.flush()
+    w.b.escapedBytes(bytes)
+    return len(bytes), w.b.err
 }
-func (w highlightWriter) BeginScope(scope interface{}) error {
-    _, err := fmt.Fprint(w.w, scope.(highlightScope).beginTags)
-    return err
+func (w *highlightWriter) BeginScope(scope interface{}) error {
+    s := scope.(highlightScope)
+    if n := len(w.ended); n > 0 && w.ended[n-1] == s {
+        // the outermost scope that ended is continuing.
+        w.ended = w.ended[:n-1]
+        return w.b.err
+    }
+    w.flush()
+    w.b.str(s.beginTags)
+    return w.b.err
+}
+func (w *highlightWriter) EndScope(scope interface{}) error {
+    w.ended = append(w.ended, scope.(highlightScope))
+    return w.b.err
 }
-func (w highlightWriter) EndScope(scope interface{}) error {
-    _, err := fmt.Fprint(w.w, scope.(highlightScope).endTags)
-    return err
+// writes the end tags held back.  call once highlighting is done.
+func (w *highlightWriter) flush() {
+    for _, s := range w.ended {
+        w.b.str(s.endTags)
+    }
+    w.ended = w.ended[:0]
 }
-func (w highlightWriter) NewLine() error {
-    _, err := fmt.Fprint(w.w, "\n")
-    return err
+func (w *highlightWriter) NewLine() error {
+    w.b.str("\n")
+    if w.b.err == nil && !w.deadline.IsZero() && time.Now().After(w.deadline) {
+        return errHighlightTooSlow
+    }
+    return w.b.err
 }
 
-func (p page) writeLineNumbers(w io.Writer, firstLine int, lines int) {
-    fmt.Fprint(w, "<td align='right' valign='top'><pre class='code line-numbers'><font color='#acb4bd'>")
+func (p page) writeLineNumbers(b *pageBuffer, firstLine int, lines int) {
+    b.str("<td align='right' valign='top'><pre class='code line-numbers'><font color='#acb4bd'>")
     for i := 0; i < lines; i++ {
-        fmt.Fprintf(w, "%d\n", firstLine + i)
+        b.int(firstLine + i)
+        b.str("\n")
     }
-    fmt.Fprint(w, "</font></pre></td>")
+    b.str("</font></pre></td>")
 }
 
 func (p page) writeProgressPage(w io.Writer, progress archiveProgress) {
-    p.writePrologue(w)
-    fmt.Fprintln(w, "    <noscript><meta http-equiv='refresh' content='3'></noscript>")
+    b := newPageBuffer(w)
+    defer b.release()
+    p.writePrologue(b)
+    b.str("    <noscript><meta http-equiv='refresh' content='3'></noscript>\n")
     downloadProgress := float64(progress.downloadedContentLength) / float64(progress.estimatedContentLength)
     if downloadProgress > 1 {
         // this can happen if the server misreports the file length somehow.
@@ -317,106 +481,247 @@ func (p page) writeProgressPage(w io.Writer, progress archiveProgress) {
     if progress.directories > 0 {
         directoryProgress = float64(progress.renderedDirectories) / float64(progress.directories)
     }
-    p.writeHeader(w, headerOptions{
+    p.writeHeader(b, headerOptions{
         inProgress: true,
         progress: 0.39 * downloadProgress + 0.4 * analysisProgress + 0.2 * directoryProgress,
     })
-    fmt.Fprintln(w, "<div class='markdown'><h1>now loading</h1><p>the archive is currently downloading. this page will reload when the download completes.</p></div>")
-    p.writeEpilogue(w)
+    b.str("<div class='markdown'><h1>now loading</h1><p>the archive is currently downloading. this page will reload when the download completes.</p></div>\n")
+    p.writeEpilogue(b)
 }
 
 func (p page) writeErrorPage(w io.Writer, err error) {
-    p.writePrologue(w)
-    p.writeHeader(w, headerOptions{})
-    fmt.Fprintln(w, "<div class='markdown'>")
-    fmt.Fprintln(w, "<h1>download failed</h1>")
-    fmt.Fprintln(w, "<p>here is the error, exactly as it has bubbled up from the depths of the computer:</p>")
-    fmt.Fprintln(w, "<p><pre>", html.EscapeString(err.Error()), "</pre></p>")
+    b := newPageBuffer(w)
+    defer b.release()
+    p.writePrologue(b)
+    p.writeHeader(b, headerOptions{})
+    b.str("<div class='markdown'>\n" +
+        "<h1>download failed</h1>\n" +
+        "<p>here is the error, exactly as it has bubbled up from the depths of the computer:</p>\n" +
+        "<p><pre> ")
+    b.escaped(err.Error())
+    b.str(" </pre></p>\n")
     if len(p.archiveURL) > 0 {
-        fmt.Fprintf(w, "<p>to retry the download, <a href='/%s?remove'>remove this archive</a>, then load the original url again.</p>\n", html.EscapeString(escapeURLPath(p.archiveURL)))
+        b.str("<p>to retry the download, <a href='/")
+        b.escaped(escapeURLPath(p.archiveURL))
+        b.str("?remove'>remove this archive</a>, then load the original url again.</p>\n")
     }
-    fmt.Fprintln(w, "</div>")
-    p.writeEpilogue(w)
+    b.str("</div>\n")
+    p.writeEpilogue(b)
 }
 
 func (p page) writeRemoveButtonPage(w io.Writer, message string) {
-    p.writePrologue(w)
-    p.writeHeader(w, headerOptions{})
-    fmt.Fprintln(w, "<div class='markdown'>")
-    fmt.Fprintln(w, "<h2>remove rendered files?</h2>")
-    fmt.Fprintln(w, "<p>the archive can be re-downloaded and re-rendered by loading the url again.</p>")
-    url := html.EscapeString(escapeURLPath(p.archiveURL))
-    fmt.Fprintf(w, "<form action='/%s?remove' method='post'><input type='submit' value='remove %s'></form>", url, url)
+    b := newPageBuffer(w)
+    defer b.release()
+    p.writePrologue(b)
+    p.writeHeader(b, headerOptions{})
+    b.str("<div class='markdown'>\n" +
+        "<h2>remove rendered files?</h2>\n" +
+        "<p>the archive can be re-downloaded and re-rendered by loading the url again.</p>\n" +
+        "<form action='/")
+    url := escapeURLPath(p.archiveURL)
+    b.escaped(url)
+    b.str("?remove' method='post'><input type='submit' value='remove ")
+    b.escaped(url)
+    b.str("'></form>")
     if len(message) > 0 {
-        fmt.Fprintf(w, "<p>%s</p>\n", html.EscapeString(message))
+        b.str("<p>")
+        b.escaped(message)
+        b.str("</p>\n")
     }
-    fmt.Fprintln(w, "</div>")
-    p.writeEpilogue(w)
+    b.str("</div>\n")
+    p.writeEpilogue(b)
 }
 
-func (p page) writeSearchResultsPage(w io.Writer, query string, filter string, results chan searchResult) {
-    p.writePrologue(w)
-    p.writeHeader(w, headerOptions{
+const searchResultsTableBegin = "    <table class='search-results'>\n" +
+    "      <colgroup><col span='1' class='line-numbers-column'><col span='1' width='*'></colgroup>\n"
+const searchResultsTableEnd = "    </table>\n"
+
+func (p page) writeSearchResultsPage(w io.Writer, query string, filter string, from searchPosition, results chan searchResult) {
+    b := newPageBuffer(w)
+    defer b.release()
+    p.writePrologue(b)
+    p.writeHeader(b, headerOptions{
         searching: true,
         searchQuery: query,
         searchFilter: filter,
     })
-    fmt.Fprintln(w, "    <table class='search-results'>")
-    fmt.Fprintln(w, "      <colgroup><col span='1' class='line-numbers-column'><col span='1' width='*'></colgroup>")
+    b.str(searchResultsTableBegin)
     lastFile := ""
     hadErrors := false
     for result := range results {
+        if result.next != nil {
+            // dezip.js replaces this link with the next page of results when
+            // it's clicked.
+            b.str("<tr class='full-border' id='more-results'><td>&nbsp;</td><td><div class='empty'><a href='?search=")
+            b.escaped(url.QueryEscape(query))
+            b.str("&amp;from=")
+            b.int(result.next.candidate)
+            b.str("&amp;match=")
+            b.int(result.next.match)
+            b.str("'>more results&hellip;</a></div></td></tr>\n")
+            continue
+        }
         if result.err != nil {
             hadErrors = true
-            fmt.Fprintf(w, "<tr class='full-border'><td>&nbsp;</td><td><div class='empty'><b>error</b>&mdash;%s</div></td></tr>\n", html.EscapeString(result.err.Error()))
+            b.str("<tr class='full-border'><td>&nbsp;</td><td><div class='empty'><b>error</b>&mdash;")
+            b.escaped(result.err.Error())
+            b.str("</div></td></tr>\n")
             continue
         }
         if result.file != lastFile {
-            components := strings.Split(result.file, "/")
-            if len(components) == 0 {
-                continue
+            // results trickle in as files are searched.  send what's ready so
+            // far before starting the next file.
+            b.flush()
+            slash := strings.LastIndex(result.file, "/")
+            b.str("      <tr><td colspan='2' class='filename'><a href='./")
+            b.escaped(escapeURLPath(result.file))
+            b.str("'>")
+            if slash > 0 {
+                b.str("<span class='prefix'>")
+                b.escaped(result.file[:slash])
+                b.str("/</span>")
             }
-            pathHTML := html.EscapeString(components[len(components)-1])
-            dir := strings.Join(components[:len(components)-1], "/")
-            if dir != "" {
-                pathHTML = fmt.Sprintf("<span class='prefix'>%s/</span>%s", html.EscapeString(dir), pathHTML)
-            }
-            fmt.Fprintf(w, "      <tr><td colspan='2' class='filename'><a href='./%s'>%s</a></td></tr>\n", html.EscapeString(escapeURLPath(result.file)), pathHTML)
+            b.escaped(result.file[slash+1:])
+            b.str("</a></td></tr>\n")
             lastFile = result.file
-            fmt.Fprint(w, "<tr>")
+            b.str("<tr>")
         } else {
-            fmt.Fprint(w, "<tr class='border'>")
+            b.str("<tr class='border'>")
         }
-        p.writeLineNumbers(w, result.firstLine, result.lines)
-        fmt.Fprintf(w, "<td><pre class='code'>\n%s</pre></td></tr>\n", result.html)
+        p.writeLineNumbers(b, result.firstLine, result.lines)
+        b.str("<td><pre class='code'>\n")
+        b.str(result.html)
+        b.str("</pre></td></tr>\n")
     }
     if lastFile == "" && query != "" && !hadErrors {
-        msg := "no results found"
-        if filter != "" {
-            msg = "no results found in paths matching <tt>" + html.EscapeString(filter) + "</tt>"
+        b.str("<tr class='full-border'><td>&nbsp;</td><td><div class='empty'>")
+        if from.candidate > 0 {
+            b.str("no more results found")
+        } else if filter != "" {
+            b.str("no results found in paths matching <tt>")
+            b.escaped(filter)
+            b.str("</tt>")
+        } else {
+            b.str("no results found")
+        }
+        b.str("</div></td></tr>\n")
+    }
+    b.str(searchResultsTableEnd)
+    p.writeEpilogue(b)
+}
+
+const diffTableBegin = "    <table class='search-results diff'>\n" +
+    "      <colgroup><col span='2' class='line-numbers-column'><col span='1' width='*'></colgroup>\n"
+const diffTableEnd = "    </table>\n"
+
+func (p page) writeDiffPage(w io.Writer, otherURL string, results chan diffResult) {
+    b := newPageBuffer(w)
+    defer b.release()
+    p.writePrologue(b)
+    p.writeHeader(b, headerOptions{})
+    b.str(diffTableBegin)
+    b.str("<tr class='full-border'><td colspan='2'>&nbsp;</td><td><div class='empty'>changes from here to <a href='/")
+    b.escaped(escapeURLPath(otherURL))
+    b.str("'>")
+    b.escaped(otherURL)
+    b.str("</a></div></td></tr>\n")
+    lastFile := ""
+    for result := range results {
+        if result.err != nil {
+            b.str("<tr class='full-border'><td colspan='2'>&nbsp;</td><td><div class='empty'><b>error</b>&mdash;")
+            b.escaped(result.err.Error())
+            b.str("</div></td></tr>\n")
+            continue
+        }
+        if result.summary != nil {
+            s := result.summary
+            b.str("<tr class='full-border'><td colspan='2'>&nbsp;</td><td><div class='empty'>")
+            b.int(s.changed)
+            b.str(" changed, ")
+            b.int(s.added)
+            b.str(" added, ")
+            b.int(s.removed)
+            b.str(" removed, ")
+            b.int(s.unchanged)
+            b.str(" unchanged</div></td></tr>\n")
+            continue
+        }
+        if result.file != lastFile {
+            b.flush()
+            link := result.newPath
+            if result.status == diffStatusRemoved {
+                link = result.oldPath
+            }
+            slash := strings.LastIndex(result.file, "/")
+            b.str("      <tr><td colspan='3' class='filename'><a href='")
+            b.escaped(escapeURLPath(link))
+            b.str("'>")
+            if slash > 0 {
+                b.str("<span class='prefix'>")
+                b.escaped(result.file[:slash])
+                b.str("/</span>")
+            }
+            b.escaped(result.file[slash+1:])
+            b.str("</a>")
+            if result.status == diffStatusAdded {
+                b.str(" <span class='prefix'>(added)</span>")
+            } else if result.status == diffStatusRemoved {
+                b.str(" <span class='prefix'>(removed)</span>")
+            }
+            b.str("</td></tr>\n")
+            lastFile = result.file
+            if len(result.note) > 0 {
+                b.str("<tr><td colspan='2'>&nbsp;</td><td><div class='empty'>")
+                b.escaped(result.note)
+                b.str("</div></td></tr>\n")
+            }
+            if len(result.html) == 0 {
+                continue
+            }
+            b.str("<tr>")
+        } else {
+            b.str("<tr class='border'>")
+        }
+        writeDiffLineNumbers(b, result.oldLineNumbers)
+        writeDiffLineNumbers(b, result.newLineNumbers)
+        b.str("<td><pre class='code'>\n")
+        b.str(result.html)
+        b.str("</pre></td></tr>\n")
+    }
+    b.str(diffTableEnd)
+    p.writeEpilogue(b)
+}
+
+// like writeLineNumbers, but zeros are left blank.
+func writeDiffLineNumbers(b *pageBuffer, numbers []int) {
+    b.str("<td align='right' valign='top'><pre class='code line-numbers'><font color='#acb4bd'>")
+    for _, n := range numbers {
+        if n > 0 {
+            b.int(n)
         }
-        fmt.Fprintf(w, "<tr class='full-border'><td>&nbsp;</td><td><div class='empty'>%s</div></td></tr>\n", msg)
+        b.str("\n")
     }
-    fmt.Fprintln(w, "    </table>")
-    p.writeEpilogue(w)
+    b.str("</font></pre></td>")
 }
 
 // tags to insert around matches in search results.
 func searchResultTags(filename string, query string, whichMatch int, globalMatch int) (string, string) {
-    return fmt.Sprintf("<a class='search-result' href='%s?search=%s#%d' id='%d'>", html.EscapeString(escapeURLPath(filename)), url.QueryEscape(query), whichMatch, globalMatch), "</a>"
+    return "<a class='search-result' href='" + html.EscapeString(escapeURLPath(filename)) + "?search=" + url.QueryEscape(query) + "#" + strconv.Itoa(whichMatch) + "' id='" + strconv.Itoa(globalMatch) + "'>", "</a>"
 }
 
 func searchAnchorTags(whichMatch int) (string, string) {
-    return fmt.Sprintf("<b class='search-result' tabindex='0' title='key shortcut: j/k to select next/prev result' id='%d'>", whichMatch), "</b>"
+    return "<b class='search-result' tabindex='0' title='key shortcut: j/k to select next/prev result' id='" + strconv.Itoa(whichMatch) + "'>", "</b>"
 }
 
-func (p page) writePrologue(w io.Writer) {
-    fmt.Fprintln(w, "<!doctype html>")
-    fmt.Fprintln(w, "<html>")
-    fmt.Fprintln(w, "  <head>")
-    fmt.Fprintln(w, "    <meta charset='utf-8'>")
-    fmt.Fprintln(w, "    <meta name='viewport' content='initial-scale=0.9'>")
-    fmt.Fprintln(w, "    <link href='/style.css' rel='stylesheet'>")
+const pagePrologue = "<!doctype html>\n" +
+    "<html>\n" +
+    "  <head>\n" +
+    "    <meta charset='utf-8'>\n" +
+    "    <meta name='viewport' content='initial-scale=0.9'>\n" +
+    "    <link href='/style.css' rel='stylesheet'>\n"
+
+func (p page) writePrologue(b *pageBuffer) {
+    b.str(pagePrologue)
 }
 
 type headerOptions struct {
@@ -428,7 +733,30 @@ type headerOptions struct {
     searchFilter string
 }
 
-func (p page) writeHeader(w io.Writer, o headerOptions) {
+const searchIcon = "<svg width='0' height='0' style='width: 19px' viewBox='0 -0.5 19 18.5' " +
+    "fill='none' xmlns='http://www.w3.org/2000/svg'><path d='M10.5872 " +
+    "10.5595C11.545 9.54455 12.1335 8.16753 12.1335 6.65098C12.1335 3.53003 " +
+    "9.64121 1 6.56677 1C3.49233 1 1 3.53003 1 6.65098C1 9.77193 3.49233 " +
+    "12.302 6.56677 12.302C8.14726 12.302 9.57391 11.6333 10.5872 " +
+    "10.5595ZM10.5872 10.5595L18 18' stroke-width='2'/></svg>"
+
+// the static parts of the header, between the variable ones.
+const headerTitleEnd = " - dezip.org</title>\n" +
+    "  </head>\n" +
+    "  <body>\n" +
+    "    <pre class='header' id='path-header'><a class='logo' href='/'>" + logo + "</a>"
+const headerOpenSearchEnd = "?search' class='search-button' id='open-search' aria-label='search'>" + searchIcon + "</a>"
+const headerSearchButton = "' id='search-header'>" +
+    "<a href='javascript:void(0);' class='search-button' id='submit-search' aria-label='submit'>" + searchIcon + "</a>" +
+    "<form action='"
+const headerSearchField = "' method='get' id='search-form' rel='noopener'>" +
+    "<input type='text' placeholder='search files in "
+const headerCancelSearch = "<a href='javascript:void(0);' class='search-button' id='cancel-search' aria-label='cancel search'>" +
+    "<svg width='0' height='0' style='width: 16px' viewBox='0 0 16 16' fill='none' xmlns='http://www.w3.org/2000/svg'>" +
+    "<path d='M15 15L8 8M1 1L8 8M8 8L15 1M8 8L1 15' stroke-width='2'/>" +
+    "</svg></a>"
+
+func (p page) writeHeader(b *pageBuffer, o headerOptions) {
     components := strings.Split(p.name, "/")
     if p.name == "" {
         components = nil
@@ -444,99 +772,239 @@ func (p page) writeHeader(w io.Writer, o headerOptions) {
     archiveComponents := strings.Split(p.archiveURL, "/")
     archiveShortName := archiveComponents[len(archiveComponents)-1]
     if o.searching && len(o.searchQuery) > 0 {
-        fmt.Fprintf(w, "    <title>searching for &ldquo;%s&rdquo; in %s", html.EscapeString(o.searchQuery), html.EscapeString(archiveShortName))
+        b.str("    <title>searching for &ldquo;")
+        b.escaped(o.searchQuery)
+        b.str("&rdquo; in ")
+        b.escaped(archiveShortName)
     } else if o.searching {
-        fmt.Fprintf(w, "    <title>searching in %s", html.EscapeString(archiveShortName))
+        b.str("    <title>searching in ")
+        b.escaped(archiveShortName)
     } else if len(components) > 0 {
-        fmt.Fprintf(w, "    <title>%s in %s", html.EscapeString(components[len(components)-1]), html.EscapeString(archiveShortName))
+        b.str("    <title>")
+        b.escaped(components[len(components)-1])
+        b.str(" in ")
+        b.escaped(archiveShortName)
         for _, v := range components[:len(components)-1] {
-            fmt.Fprintf(w, "/%s", html.EscapeString(v))
+            b.str("/")
+            b.escaped(v)
         }
     } else {
-        fmt.Fprintf(w, "    <title>%s", html.EscapeString(archiveShortName))
+        b.str("    <title>")
+        b.escaped(archiveShortName)
     }
-    fmt.Fprintln(w, " - dezip.org</title>")
-    fmt.Fprintln(w, "  </head>")
-    fmt.Fprintln(w, "  <body>")
-
-    fmt.Fprint(w, "    <pre class='header' id='path-header'><a class='logo' href='/'>", logo, "</a>")
+    b.str(headerTitleEnd)
     if o.searching {
-        fmt.Fprint(w, "<b><i>searching in </i></b>")
+        b.str("<b><i>searching in </i></b>")
     }
     if depth == 0 && !o.searching && p.isDirectory {
-        fmt.Fprintf(w, "<b>%s</b>", html.EscapeString(p.archiveURL))
+        b.str("<b>")
+        b.escaped(p.archiveURL)
+        b.str("</b>")
     } else {
-        fmt.Fprintf(w, "<a href='%s'>%s</a>", rootPath, html.EscapeString(archiveShortName))
+        b.str("<a href='")
+        b.str(rootPath)
+        b.str("'>")
+        b.escaped(archiveShortName)
+        b.str("</a>")
     }
     if o.searching {
         if len(o.searchFilter) > 0 {
-            fmt.Fprintf(w, "<b id='search-filter'> [%s]</b>", html.EscapeString(o.searchFilter))
+            b.str("<b id='search-filter'> [")
+            b.escaped(o.searchFilter)
+            b.str("]</b>")
         } else {
-            fmt.Fprint(w, "<b id='search-filter'>...</b>")
+            b.str("<b id='search-filter'>...</b>")
         }
     }
     for i, v := range components {
         if i == len(components) - 1 {
-            fmt.Fprintf(w, " / <b>%s</b>", html.EscapeString(v))
+            b.str(" / <b>")
+            b.escaped(v)
+            b.str("</b>")
         } else if depth - i - 1 == 0 {
-            fmt.Fprintf(w, " / <a href='.'>%s</a>", html.EscapeString(v))
+            b.str(" / <a href='.'>")
+            b.escaped(v)
+            b.str("</a>")
         } else {
-            fmt.Fprintf(w, " / <a href='%s'>%s</a>", strings.Repeat("../", depth - i - 1), html.EscapeString(v))
+            b.str(" / <a href='")
+            for j := 0; j < depth - i - 1; j++ {
+                b.str("../")
+            }
+            b.str("'>")
+            b.escaped(v)
+            b.str("</a>")
         }
     }
-    searchIcon := "<svg width='0' height='0' style='width: 19px' viewBox='0 -0.5 19 18.5' " +
-     "fill='none' xmlns='http://www.w3.org/2000/svg'><path d='M10.5872 " +
-     "10.5595C11.545 9.54455 12.1335 8.16753 12.1335 6.65098C12.1335 3.53003 " +
-     "9.64121 1 6.56677 1C3.49233 1 1 3.53003 1 6.65098C1 9.77193 3.49233 " +
-     "12.302 6.56677 12.302C8.14726 12.302 9.57391 11.6333 10.5872 " +
-     "10.5595ZM10.5872 10.5595L18 18' stroke-width='2'/></svg>"
     if !o.searching {
-        fmt.Fprintf(w, "  <a href='%s?search' class='search-button' id='open-search' aria-label='search'>", rootPath)
-        fmt.Fprint(w, searchIcon)
-        fmt.Fprint(w, "</a>")
+        b.str("  <a href='")
+        b.str(rootPath)
+        b.str(headerOpenSearchEnd)
     }
     if o.inProgress {
-        fmt.Fprintf(w, "<span id='progress-overlay' style='left: %f%%'></span>", o.progress * 100)
+        b.str("<span id='progress-overlay' style='left: ")
+        b.float(o.progress * 100, 6)
+        b.str("%'></span>")
     }
-    fmt.Fprintln(w, "</pre>")
-    fmt.Fprint(w, "    <pre class='header")
+    b.str("</pre>\n    <pre class='header")
     if o.searching {
-        fmt.Fprint(w, " searching")
-    }
-    fmt.Fprint(w, "' id='search-header'>")
-    fmt.Fprint(w, "<a href='javascript:void(0);' class='search-button' id='submit-search' aria-label='submit'>")
-    fmt.Fprint(w, searchIcon)
-    fmt.Fprint(w, "</a>")
-    fmt.Fprintf(w, "<form action='%s' method='get' id='search-form' rel='noopener'>", rootPath)
-    autofocus := ""
+        b.str(" searching")
+    }
+    b.str(headerSearchButton)
+    b.str(rootPath)
+    b.str(headerSearchField)
+    b.escaped(archiveShortName)
+    b.str("' value='")
+    b.escaped(o.searchQuery)
+    b.str("' name='search' id='search-field' autocapitalize='none' autocorrect='off' autocomplete='off'")
     if o.searching && o.searchQuery == "" {
-        autofocus = " autofocus"
+        b.str(" autofocus")
     }
-    fmt.Fprintf(w, "<input type='text' placeholder='search files in %s' value='%s' name='search' id='search-field' autocapitalize='none' autocorrect='off' autocomplete='off'%s>", html.EscapeString(archiveShortName), html.EscapeString(o.searchQuery), autofocus)
-    fmt.Fprint(w, "</form>&nbsp;")
+    b.str(">")
+    b.str("</form>&nbsp;")
     if !o.searching {
-        fmt.Fprint(w, "<a href='javascript:void(0);' class='search-button' id='cancel-search' aria-label='cancel search'>")
-        fmt.Fprint(w, "<svg width='0' height='0' style='width: 16px' viewBox='0 0 16 16' fill='none' xmlns='http://www.w3.org/2000/svg'>")
-        fmt.Fprint(w, "<path d='M15 15L8 8M1 1L8 8M8 8L15 1M8 8L1 15' stroke-width='2'/>")
-        fmt.Fprint(w, "</svg></a>")
+        b.str(headerCancelSearch)
     }
-    fmt.Fprintln(w, "</pre>")
-    fmt.Fprintln(w, "    <script src='/dezip.js'></script>")
+    b.str("</pre>\n" +
+        "    <script src='/dezip.js'></script>\n")
 }
 
-func (p page) writeEpilogue(w io.Writer) {
-    fmt.Fprintln(w, "  </body>")
-    fmt.Fprintln(w, "</html>")
+func (p page) writeEpilogue(b *pageBuffer) {
+    b.str("  </body>\n" +
+        "</html>\n")
 }
 
-func formatTime(t time.Time) string {
-    return strings.ToLower(t.Format("<span class='abbr abbr-January'><span>January</span></span> 2, 2006"))
-}
+const timeLayout = "<span class='abbr abbr-January'><span>January</span></span> 2, 2006"
 
 func escapeURLPath(p string) string {
     return (&url.URL{ Path: p }).EscapedPath()
 }
 
+// -- page buffers
+
+// pages are assembled by appending to a byte slice, which is written out
+// whenever it grows past pageBufferFlushSize.  the slices are pooled, so
+// writing a page doesn't allocate much beyond the escaped url paths.
+const pageBufferFlushSize = 32 * 1024
+
+type pageBuffer struct {
+    w io.Writer
+    b []byte
+    // the first error returned by w.
+    err error
+}
+
+var pageBufferPool = sync.Pool{
+    New: func () interface{} {
+        return &pageBuffer{ b: make([]byte, 0, 2 * pageBufferFlushSize) }
+    },
+}
+
+func newPageBuffer(w io.Writer) *pageBuffer {
+    b := pageBufferPool.Get().(*pageBuffer)
+    b.w = w
+    b.err = nil
+    return b
+}
+
+// flushes the buffer and returns it to the pool.
+func (b *pageBuffer) release() {
+    b.flush()
+    b.w = nil
+    if cap(b.b) <= 4 * pageBufferFlushSize {
+        pageBufferPool.Put(b)
+    }
+}
+
+func (b *pageBuffer) flush() {
+    if len(b.b) > 0 && b.err == nil {
+        _, b.err = b.w.Write(b.b)
+    }
+    b.b = b.b[:0]
+}
+
+func (b *pageBuffer) flushIfFull() {
+    if len(b.b) >= pageBufferFlushSize {
+        b.flush()
+    }
+}
+
+// pageBuffer is also an io.Writer, for things like goldmark that want one.
+func (b *pageBuffer) Write(p []byte) (int, error) {
+    b.b = append(b.b, p...)
+    b.flushIfFull()
+    return len(p), b.err
+}
+
+func (b *pageBuffer) str(s string) {
+    b.b = append(b.b, s...)
+    b.flushIfFull()
+}
+
+func (b *pageBuffer) int(n int) {
+    b.b = strconv.AppendInt(b.b, int64(n), 10)
+}
+
+// formats like %.Nf.
+func (b *pageBuffer) float(f float64, decimals int) {
+    b.b = strconv.AppendFloat(b.b, f, 'f', decimals, 64)
+}
+
+func (b *pageBuffer) time(t time.Time) {
+    start := len(b.b)
+    b.b = t.AppendFormat(b.b, timeLayout)
+    // the layout and month names are ascii, so lowercasing in place is the
+    // same as strings.ToLower.
+    for i := start; i < len(b.b); i++ {
+        if c := b.b[i]; c >= 'A' && c <= 'Z' {
+            b.b[i] = c + ('a' - 'A')
+        }
+    }
+}
+
+// escaped() and escapedBytes() escape the same characters as
+// html.EscapeString.
+func (b *pageBuffer) escaped(s string) {
+    last := 0
+    for i := 0; i < len(s); i++ {
+        if entity := htmlEntities[s[i]]; entity != "" {
+            b.b = append(b.b, s[last:i]...)
+            b.b = append(b.b, entity...)
+            last = i + 1
+        }
+    }
+    b.b = append(b.b, s[last:]...)
+    b.flushIfFull()
+}
+
+func (b *pageBuffer) escapedBytes(p []byte) {
+    for len(p) > 0 {
+        // escape large inputs in pieces so the buffer stays small.
+        n := len(p)
+        if n > pageBufferFlushSize {
+            n = pageBufferFlushSize
+        }
+        last := 0
+        for i, c := range p[:n] {
+            if entity := htmlEntities[c]; entity != "" {
+                b.b = append(b.b, p[last:i]...)
+                b.b = append(b.b, entity...)
+                last = i + 1
+            }
+        }
+        b.b = append(b.b, p[last:n]...)
+        b.flushIfFull()
+        p = p[n:]
+    }
+}
+
+var htmlEntities = [256]string{
+    '&': "&amp;",
+    '\'': "&#39;",
+    '<': "&lt;",
+    '>': "&gt;",
+    '"': "&#34;",
+}
+
 const logo = `<svg width='0' height='0' style='width: 24px' viewBox='0 0 24
  12' stroke='none' xmlns='http://www.w3.org/2000/svg'><path fill-rule='evenodd'
  clip-rule='evenodd' d='M4 8.5V9.0975C4 10.1632 4.83571 11.0418 5.90013
@@ -0,0 +1,117 @@
+package main
+
+import (
+    "archive/zip"
+    "bytes"
+    "fmt"
+    "io/ioutil"
+    "strings"
+    "testing"
+    "time"
+)
+
+// benchmarks for the page writers.  the pages are written to ioutil.Discard,
+// from trees and zips built in memory.
+
+const benchmarkFileLines = 1000000
+
+func benchmarkDirectoryTree(b *testing.B, files int) *directoryTree {
+    tree := newDirectoryTree()
+    modified := time.Date(2021, 1, 17, 12, 0, 0, 0, time.UTC)
+    for i := 0; i < files; i++ {
+        name := fmt.Sprintf("src/module%d/file%d.go", i % 20, i)
+        entry := &archiveDirectoryEntry{
+            file: &zip.File{ FileHeader: zip.FileHeader{ Name: name, UncompressedSize64: uint64(i * 37) } },
+            modified: modified,
+            lines: i % 500,
+        }
+        if err := tree.add(entry, strings.Split(name, "/")); err != nil {
+            b.Fatal(err)
+        }
+    }
+    tree.finish()
+    return tree
+}
+
+func BenchmarkWriteDirectoryPage(b *testing.B) {
+    tree := benchmarkDirectoryTree(b, 20000)
+    // the directory with the most files.
+    id := tree.subdirectories(tree.subdirectories(rootDirectoryNode)[0])[0]
+    p := page{ name: tree.path(id) + "/", isDirectory: true, archiveURL: "https/example.org/archive.zip" }
+    b.ReportAllocs()
+    b.ResetTimer()
+    for i := 0; i < b.N; i++ {
+        p.writeDirectoryPage(ioutil.Discard, tree, id)
+    }
+}
+
+// returns an entry for a stored (uncompressed) file of the given number of
+// lines.
+func benchmarkFileEntry(b *testing.B, lines int) *archiveDirectoryEntry {
+    var contents bytes.Buffer
+    for i := 0; i < lines; i++ {
+        fmt.Fprintf(&contents, "    x := f(%d) + \"<string & %d>\"\n", i, i)
+    }
+    var archive bytes.Buffer
+    zw := zip.NewWriter(&archive)
+    w, err := zw.CreateHeader(&zip.FileHeader{ Name: "big.txt", Method: zip.Store })
+    if err != nil {
+        b.Fatal(err)
+    }
+    w.Write(contents.Bytes())
+    if err := zw.Close(); err != nil {
+        b.Fatal(err)
+    }
+    zr, err := zip.NewReader(bytes.NewReader(archive.Bytes()), int64(archive.Len()))
+    if err != nil {
+        b.Fatal(err)
+    }
+    return &archiveDirectoryEntry{ file: zr.File[0], lines: lines }
+}
+
+func BenchmarkWriteFilePage(b *testing.B) {
+    entry := benchmarkFileEntry(b, benchmarkFileLines)
+    p := page{ name: "big.txt", archiveURL: "https/example.org/archive.zip" }
+    b.SetBytes(int64(entry.file.UncompressedSize64))
+    b.ReportAllocs()
+    b.ResetTimer()
+    for i := 0; i < b.N; i++ {
+        if err := p.writeFilePage(ioutil.Discard, nil, time.Time{}, entry, contentTypeText); err != nil {
+            b.Fatal(err)
+        }
+    }
+}
+
+func BenchmarkWriteLineNumbers(b *testing.B) {
+    p := page{ name: "big.txt" }
+    b.ReportAllocs()
+    for i := 0; i < b.N; i++ {
+        buf := newPageBuffer(ioutil.Discard)
+        p.writeLineNumbers(buf, 1, benchmarkFileLines)
+        buf.release()
+    }
+}
+
+func BenchmarkWriteSearchResultsPage(b *testing.B) {
+    var results []searchResult
+    for i := 0; i < 2000; i++ {
+        begin, end := searchResultTags("", "query", i, i)
+        results = append(results, searchResult{
+            file: fmt.Sprintf("src/module%d/file%d.go", i / 20, i / 20),
+            firstLine: i * 10,
+            lines: 3,
+            html: "    before the match\n    a " + begin + "query" + end + " &amp; more\n    after\n",
+        })
+    }
+    p := page{ name: "", isDirectory: true, archiveURL: "https/example.org/archive.zip" }
+    b.ReportAllocs()
+    b.ResetTimer()
+    for i := 0; i < b.N; i++ {
+        c := make(chan searchResult, len(results))
+        for _, result := range results {
+            c <- result
+        }
+        close(c)
+        p.writeSearchResultsPage(ioutil.Discard, "query", "", searchPosition{}, c)
+    }
+}
@@ -0,0 +1,270 @@
+package main
+
+import (
+    "context"
+    "crypto/subtle"
+    "errors"
+    "fmt"
+    "hash/fnv"
+    "log"
+    "net"
+    "net/http"
+    "net/http/httputil"
+    "net/url"
+    "os"
+    "sort"
+    "strings"
+    "sync"
+    "time"
+)
+
+// several dezip nodes can share the work of caching archives.  set
+// DEZIP_PEERS to the base urls of every node (including this one), separated
+// by commas, DEZIP_SELF to this node's url from that list (by default,
+// http:// followed by the listen address), and DEZIP_PEER_SECRET to a secret
+// shared by every node.  each archive url is owned by one
+// node, chosen by consistent hashing, and the others proxy requests for it to
+// the owner, so each archive is downloaded, rendered, and stored once.
+//
+// nodes check on each other every peerCheckInterval.  when one stops
+// responding, its archives are spread over the rest; when it comes back, it
+// gets them back.  archives a node no longer owns are reclaimed first when it
+// runs low on space.
+const peerCheckInterval = 2 * time.Second
+const peerCheckTimeout = 1 * time.Second
+
+// how many points each node has on the hash ring.  more points spread
+// archives more evenly, and move fewer of them when a node comes or goes.
+const peerRingPoints = 64
+
+// nodes answer requests for this path with 200, so other nodes can tell
+// they're up.
+const peerCheckPath = "/peer.from.dezip"
+
+// proxied requests carry this header: the shared secret, then the node which
+// forwarded them.  the owner always handles these itself, even if its own
+// view of the ring disagrees, so a request can't bounce between nodes.
+// clients don't know the secret, so they can't make a node serve an archive
+// it doesn't own.
+const peerForwardedHeader = "X-Dezip-Forwarded-By"
+
+type peer struct {
+    url string
+    proxy *httputil.ReverseProxy
+    // protected by peers.mutex.
+    up bool
+}
+
+type peerRingPoint struct {
+    hash uint64
+    peer *peer
+}
+
+type peers struct {
+    self *peer
+    all []*peer
+    secret string
+
+    mutex sync.RWMutex
+    ring []peerRingPoint
+
+    // called (without the mutex held) whenever the ring changes.
+    changed func ()
+}
+
+// returns nil if DEZIP_PEERS isn't set.  requests which fail to reach their
+// owner are handed back to local, to go to whichever node owns the archive
+// once the owner is out of the ring.
+func newPeers(listenAddress string, local http.Handler) (*peers, error) {
+    list := os.Getenv("DEZIP_PEERS")
+    if list == "" {
+        return nil, nil
+    }
+    self := os.Getenv("DEZIP_SELF")
+    if self == "" {
+        self = "http://" + listenAddress
+    }
+    self = strings.TrimSuffix(self, "/")
+    ps := &peers{ secret: os.Getenv("DEZIP_PEER_SECRET") }
+    if ps.secret == "" || strings.Contains(ps.secret, " ") {
+        return nil, fmt.Errorf("set DEZIP_PEER_SECRET to a secret (without spaces) shared by every node in DEZIP_PEERS")
+    }
+    for _, u := range strings.Split(list, ",") {
+        u = strings.TrimSuffix(strings.TrimSpace(u), "/")
+        if u == "" {
+            continue
+        }
+        target, err := url.Parse(u)
+        if err != nil {
+            return nil, fmt.Errorf("DEZIP_PEERS: %v", err)
+        }
+        p := &peer{ url: u, up: true }
+        if u == self {
+            ps.self = p
+        } else {
+            p.proxy = ps.newProxy(p, target, local)
+        }
+        ps.all = append(ps.all, p)
+    }
+    if ps.self == nil {
+        return nil, fmt.Errorf("DEZIP_PEERS doesn't include this node (%s); set DEZIP_SELF to its url", self)
+    }
+    ps.buildRing()
+    return ps, nil
+}
+
+func (ps *peers) newProxy(p *peer, target *url.URL, local http.Handler) *httputil.ReverseProxy {
+    proxy := httputil.NewSingleHostReverseProxy(target)
+    director := proxy.Director
+    proxy.Director = func (request *http.Request) {
+        director(request)
+        request.Header.Set(peerForwardedHeader, ps.forwardedBy(ps.self.url))
+    }
+    proxy.ErrorHandler = func (response http.ResponseWriter, request *http.Request, err error) {
+        if errors.Is(err, context.Canceled) || request.Context().Err() != nil {
+            // the client went away, which says nothing about the owner.
+            return
+        }
+        var opErr *net.OpError
+        if !errors.As(err, &opErr) || opErr.Op != "dial" {
+            // the owner was reached, and may have seen the request, so it
+            // can't be retried here.
+            log.Printf("proxying to %s: %v", p.url, err)
+            response.WriteHeader(502)
+            fmt.Fprint(response, "502 the dezip node with this archive didn't answer")
+            return
+        }
+        // the owner went away.  take it out of the ring now rather than
+        // waiting for the next check, and try again with the new owner.
+        // this ends at the latest when this node owns the archive.
+        log.Printf("couldn't reach %s: %v", p.url, err)
+        ps.setUp(p, false)
+        request.Header.Del(peerForwardedHeader)
+        local.ServeHTTP(response, request)
+    }
+    return proxy
+}
+
+// the value of peerForwardedHeader for requests forwarded by from.
+func (ps *peers) forwardedBy(from string) string {
+    return ps.secret + " " + from
+}
+
+// reports whether request was forwarded by another node, checking the secret
+// in its peerForwardedHeader.
+func (ps *peers) forwarded(request *http.Request) bool {
+    if ps == nil {
+        return false
+    }
+    secret := strings.SplitN(request.Header.Get(peerForwardedHeader), " ", 2)[0]
+    return subtle.ConstantTimeCompare([]byte(secret), []byte(ps.secret)) == 1
+}
+
+func peerHash(s string) uint64 {
+    h := fnv.New64a()
+    h.Write([]byte(s))
+    // fnv's low bits are poorly mixed for short, similar strings like the
+    // ring points of a node, so finish with a multiply-xorshift.
+    x := h.Sum64()
+    x ^= x >> 33
+    x *= 0xff51afd7ed558ccd
+    x ^= x >> 33
+    return x
+}
+
+// called with ps.mutex held (or before anything else can see ps).
+func (ps *peers) buildRing() {
+    ps.ring = ps.ring[:0]
+    for _, p := range ps.all {
+        if !p.up {
+            continue
+        }
+        for i := 0; i < peerRingPoints; i++ {
+            ps.ring = append(ps.ring, peerRingPoint{ peerHash(fmt.Sprintf("%s#%d", p.url, i)), p })
+        }
+    }
+    sort.Slice(ps.ring, func (i, j int) bool { return ps.ring[i].hash < ps.ring[j].hash })
+}
+
+// returns the node which owns archiveURL, or nil if this node does.
+func (ps *peers) owner(archiveURL string) *peer {
+    if ps == nil {
+        return nil
+    }
+    h := peerHash(archiveURL)
+    ps.mutex.RLock()
+    defer ps.mutex.RUnlock()
+    i := sort.Search(len(ps.ring), func (i int) bool { return ps.ring[i].hash >= h })
+    if i == len(ps.ring) {
+        i = 0
+    }
+    if ps.ring[i].peer == ps.self {
+        return nil
+    }
+    return ps.ring[i].peer
+}
+
+func (ps *peers) setUp(p *peer, up bool) {
+    ps.mutex.Lock()
+    if p.up == up {
+        ps.mutex.Unlock()
+        return
+    }
+    p.up = up
+    if up {
+        log.Printf("peer %s is up; its archives are moving back to it", p.url)
+    } else {
+        log.Printf("peer %s is down; its archives are moving to the other nodes", p.url)
+    }
+    ps.buildRing()
+    ps.mutex.Unlock()
+    if ps.changed != nil {
+        ps.changed()
+    }
+}
+
+// checks on the other nodes forever.  the first check waits a while, so
+// nodes started together don't count each other as down.
+func (ps *peers) checkLoop() {
+    client := &http.Client{ Timeout: peerCheckTimeout }
+    for {
+        time.Sleep(peerCheckInterval)
+        var wg sync.WaitGroup
+        for _, p := range ps.all {
+            if p == ps.self {
+                continue
+            }
+            wg.Add(1)
+            go func (p *peer) {
+                defer wg.Done()
+                up := false
+                if res, err := client.Get(p.url + peerCheckPath); err == nil {
+                    res.Body.Close()
+                    up = res.StatusCode == 200
+                }
+                ps.setUp(p, up)
+            }(p)
+        }
+        wg.Wait()
+    }
+}
+
+// moves archives owned by other nodes to the front of the reclamation order.
+// they're still served until they're reclaimed, but only to requests that
+// were forwarded here.
+func (c *cache) reclaimArchivesOwnedByPeers() {
+    c.mutex.Lock()
+    defer c.mutex.Unlock()
+    var others, own []string
+    for _, u := range c.archiveURLsToReclaim {
+        if c.peers.owner(u) != nil {
+            others = append(others, u)
+        } else {
+            own = append(own, u)
+        }
+    }
+    c.archiveURLsToReclaim = append(others, own...)
+    if len(others) > 0 {
+        log.Printf("%d cached archives are now owned by other nodes", len(others))
+    }
+}
@@ -18,7 +18,9 @@ const highWaterMark = 10_000_000_000 // 10 GB
 const reclamationInterval = 1 * time.Second
 
 func (c *cache) reclaim(archiveURL string) (err error) {
+    c.mutex.RLock()
     ar := c.archivesByURL[archiveURL]
+    c.mutex.RUnlock()
     if ar == nil {
         err = fmt.Errorf("couldn't find archive for URL %s", archiveURL)
         return
@@ -44,6 +46,7 @@ func (c *cache) reclaim(archiveURL string) (err error) {
     ar.mutex.Unlock()
 
     log.Printf("reclaiming archive %s", ar.path)
+    c.hotPages.evictArchive(ar)
     c.reclaimFiles(ar.path)
 
     return
@@ -57,6 +60,13 @@ func (c *cache) reclaimLoop() {
                     err = fmt.Errorf("panic during reclaimIfNeeded: %v\n%v", r, string(debug.Stack()))
                 }
             }()
+            c.mutex.RLock()
+            handedOff := c.handedOff
+            c.mutex.RUnlock()
+            if handedOff {
+                // the successor reclaims archives now (see restart.go).
+                return
+            }
             var bytes uint64
             if bytes, err = availableBytes(c.rootPath); err != nil {
                 return
@@ -65,11 +75,15 @@ func (c *cache) reclaimLoop() {
                 return
             }
             for bytes < highWaterMark {
+                c.mutex.RLock()
                 if len(c.archiveURLsToReclaim) == 0 {
+                    c.mutex.RUnlock()
                     err = fmt.Errorf("still low on space, even after reclaiming all archives")
                     return
                 }
-                if err = c.reclaim(c.archiveURLsToReclaim[0]); err != nil {
+                oldest := c.archiveURLsToReclaim[0]
+                c.mutex.RUnlock()
+                if err = c.reclaim(oldest); err != nil {
                     return
                 }
                 if bytes, err = availableBytes(c.rootPath); err != nil {
@@ -100,7 +114,7 @@ func (c *cache) reclaimFiles(archivePath string) {
 }
 
 func reclaimDirectory(directory string) {
-    os.RemoveAll(directory)
+    removeTree(directory)
     // reclaim empty parent directories.
     for {
         directory = path.Dir(directory)
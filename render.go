@@ -8,6 +8,7 @@ import (
     "encoding/binary"
     "encoding/hex"
     "encoding/json"
+    "errors"
     "fmt"
     "hash/crc32"
     "io"
@@ -16,9 +17,10 @@ import (
     "os"
     "path"
     "runtime/debug"
-    "sort"
+    "strconv"
     "strings"
     "sync"
+    "sync/atomic"
     "time"
 
     "howett.net/plist"
@@ -26,6 +28,11 @@ import (
 )
 
 type archive struct {
+    // the number of bytes downloaded so far.  this is updated for every read
+    // from the network, so it's accessed atomically rather than under the
+    // mutex.  (it comes first to keep it 64-bit aligned.)
+    downloadedBytes int64
+
     mutex sync.Mutex
 
     // the current state of the archive -- see archiveState below.
@@ -42,7 +49,7 @@ type archive struct {
     progress archiveProgress
 
     // these are set during the downloading state and used while rendering.
-    directories map[string]*archiveDirectory
+    directories *directoryTree
     filesToRender []*archiveDirectoryEntry
     filesToRenderByName map[string]int
 
@@ -59,15 +66,8 @@ type archive struct {
     // this channel is closed when the archive is finished being downloaded.
     downloaded chan struct{}
 
-    // renderers update these as they progress through the filesToRender array.
-    // when filesBeingRendered is 0 and nextFileToRender is len(filesToRender),
-    // rendering is finished.
-    nextFileToRender int
-    filesBeingRendered int
-    // the number of files which have been reordered to the next index.  without
-    // this, every http request would swap its priority file to the same index,
-    // clobbering other requests in progress.
-    priorityFiles int
+    // renderers take files from this queue during the rendering state.
+    renderQueue *renderQueue
 
     // file contents are stored in a zip file until rendering is finished.  keep
     // a reference to the zip reader so it can be closed after it is no longer
@@ -125,13 +125,17 @@ func (ar *archive) transitionToState(state archiveState) {
         writeMetadataChecksum(ar.searchIndex.file)
     }
     if state == archiveStateDownloading {
-        ar.directories = make(map[string]*archiveDirectory)
+        ar.directories = newDirectoryTree()
         ar.filesToRenderByName = make(map[string]int)
     }
     if !wasFinishedOrFailed && (state == archiveStateFinished || state == archiveStateFailed) {
         globalMutex.Lock()
         activeArchives--
         globalMutex.Unlock()
+        if ar.renderQueue != nil {
+            atomic.StoreInt32(&ar.renderQueue.stopped, 1)
+            ar.renderQueue = nil
+        }
         ar.directories = nil
         ar.filesToRender = nil
         ar.filesToRenderByName = nil
@@ -156,7 +160,8 @@ type archiveProgress struct {
     // an estimate of the number of bytes in the file.  may be (much) larger
     // than the real size.
     estimatedContentLength int64
-    // how many bytes of the file have been downloaded?
+    // how many bytes of the file have been downloaded?  only filled in by
+    // progressSnapshot() -- the live count is archive.downloadedBytes.
     downloadedContentLength int64
     // after downloading a zip, we have to analyze each file to determine how
     // many lines it has.
@@ -168,14 +173,6 @@ type archiveProgress struct {
     renderedDirectories int
 }
 
-type archiveDirectory struct {
-    entries map[string]*archiveDirectoryEntry
-
-    directoryNames []string
-    fileNames []string
-    readmeName string
-}
-
 type archiveDirectoryEntry struct {
     // nil for directories.
     file *zip.File
@@ -192,55 +189,13 @@ type archiveDirectoryEntry struct {
     maximumLineLength int
 }
 
-func (ar *archive) addDirectoryEntry(file *archiveDirectoryEntry, components []string) error {
-    var newDirectoryEntries uint64
-    for index, component := range components {
-        // create the containing directory.
-        path := components[:index]
-        key := strings.Join(path, "/")
-        dir := ar.directories[key]
-        if dir == nil {
-            dir = &archiveDirectory{ entries: make(map[string]*archiveDirectoryEntry) }
-            ar.directories[key] = dir
-        }
-        // check for empty path components.
-        isIntermediateDirectory := index != len(components) - 1
-        if len(component) == 0 {
-            if index == 0 {
-                return fmt.Errorf("addDirectoryEntry(): absolute path %v not allowed", strings.Join(components, "/"))
-            } else if isIntermediateDirectory {
-                return fmt.Errorf("addDirectoryEntry(): empty directory not allowed in path %v", strings.Join(components, "/"))
-            } else {
-                // if the last component is empty, this is just a directory
-                // name.  there's nothing left to do here.
-                break
-            }
-        }
-        if isIntermediateDirectory {
-            // keep track of the most recent modification date for each
-            // intermediate directory.  also count the total number of lines
-            // because why not.
-            entry := dir.entries[component]
-            if entry == nil {
-                entry = &archiveDirectoryEntry{}
-                dir.entries[component] = entry
-                newDirectoryEntries++
-            }
-            if file.modified.After(entry.modified) {
-                entry.modified = file.modified
-            }
-            entry.lines += file.lines
-        } else {
-            // this is the entry for the file itself.
-            dir.entries[component] = file
-            newDirectoryEntries++
-        }
-        if len(dir.entries) > entriesPerDirectoryLimit {
-            return fmt.Errorf("addDirectoryEntry(): directory '%s' has more than %d entries", key, entriesPerDirectoryLimit)
-        }
-    }
-    return nil
+// call with ar.mutex held.
+func (ar *archive) progressSnapshot() archiveProgress {
+    progress := ar.progress
+    progress.downloadedContentLength = atomic.LoadInt64(&ar.downloadedBytes)
+    return progress
 }
+
 func (ar *archive) requestRender(name string) chan struct{} {
     if ar.state == archiveStateFinished {
         // assume the file is there.
@@ -262,26 +217,20 @@ func (ar *archive) requestRender(name string) chan struct{} {
             // the file is already rendered; there's nothing to do.
             break
         default:
-            // move the requested file to the next index in the
-            // filesToRender slice so it's rendered soon.
-            index, ok := ar.filesToRenderByName[name]
-            priorityIndex := ar.nextFileToRender + ar.priorityFiles
-            if ok && index > priorityIndex {
-                fs := ar.filesToRender
-                file := fs[index]
-                fs[index] = fs[priorityIndex]
-                fs[priorityIndex] = file
-                ar.filesToRenderByName[fs[index].file.Name] = index
-                ar.filesToRenderByName[fs[priorityIndex].file.Name] = priorityIndex
-                ar.priorityFiles++
-            }
+            // ask the renderers to render the file next.
+            ar.renderQueue.prioritize(name)
         }
     }
     return rendered
 }
 func (ar *archive) notifyRendered(name string) {
     if ch, ok := ar.renderedFiles[name]; ok {
-        close(ch)
+        select {
+        case <-ch:
+            // a plain version of the file was already rendered.
+        default:
+            close(ch)
+        }
     } else {
         ar.renderedFiles[name] = closedChannel
     }
@@ -333,7 +282,27 @@ func (c *cache) download(p page, format archiveFormat, protocol protocol, archiv
     archive.progress.filesToAnalyze = len(rc.File)
     archive.searchIndex = searchIndex
     archive.mutex.Unlock()
-    var buffer bytes.Buffer
+    // see extract.go.
+    extraction, err := newZipExtraction(rc.File)
+    if err != nil {
+        return err
+    }
+    if extraction != nil {
+        defer func () {
+            if extraction != nil {
+                extraction.discard()
+            }
+        }()
+    }
+    analyzed := func (file *zip.File) bool {
+        return file.UncompressedSize64 <= textFileSizeLimit && !strings.HasSuffix(file.Name, "/")
+    }
+    info, err := f.Stat()
+    if err != nil {
+        return err
+    }
+    reads := readZipFilesAhead(rc.File, info.Size(), analyzed)
+    defer reads.close()
     var totalSize uint64
     for _, file := range rc.File {
         totalSize += file.UncompressedSize64
@@ -348,10 +317,11 @@ func (c *cache) download(p page, format archiveFormat, protocol protocol, archiv
             return fmt.Errorf("number of path components in %s greater than limit %d", file.Name, archiveComponentLimit)
         }
         invalidComponent := findInvalidComponent(components)
-        if invalidComponent == indexFileName {
-            // just ignore files and directories that match the
-            // index file name. otherwise these files/directories
-            // would overwrite the directory index pages.
+        if invalidComponent == indexFileName || invalidComponent == directoryManifestFileName || invalidComponent == renderTemporaryDirectoryName {
+            // just ignore files and directories that match the index,
+            // manifest, or temporary directory names.  otherwise these
+            // files/directories would overwrite the directory index pages
+            // or other files' renders.
             continue
         } else if len(invalidComponent) > 0 {
             return fmt.Errorf("filename %s contains a . or ..", file.Name)
@@ -364,68 +334,77 @@ func (c *cache) download(p page, format archiveFormat, protocol protocol, archiv
         if strings.HasSuffix(file.Name, "/") {
             entry.file = nil
         }
-        if file.UncompressedSize64 <= textFileSizeLimit && entry.file != nil {
-            rc, err := entry.file.Open()
-            if err == nil {
-                buffer.Reset()
-                _, err := buffer.ReadFrom(rc)
-                rc.Close()
-                if err == nil {
-                    // count the number of lines in the file.  if the file
-                    // doesn't look like text, set the number of lines to a
-                    // negative number.
-                    weirdCharacters := 0
-                    entry.lines = 1
-                    contents := buffer.Bytes()
-                    blankLine := true
-                    lineLength := 0
-                    for i := 0; i < len(contents); i++ {
-                        switch contents[i] {
-                        case '\r':
-                            if i + 1 < len(contents) && contents[i + 1] == '\n' {
-                                i++
-                            }
-                            fallthrough
-                        case '\n':
-                            entry.lines++
-                            if lineLength > entry.maximumLineLength {
-                                entry.maximumLineLength = lineLength
-                            }
-                            lineLength = 0
-                            blankLine = true
-                        case 0:
-                            // this isn't utf-8 text.
-                            entry.lines = -1
-                        default:
-                            if contents[i] > 0xf4 {
-                                // this isn't utf-8 text, but some files in the
-                                // linux source tree use non-utf-8 codepages.
-                                // so we allow a few illegal characters through
-                                // (they'll show up as 0xFFFD on the web).
-                                weirdCharacters++
-                                if weirdCharacters > weirdCharacterLimit {
-                                    entry.lines = -1
-                                    break
-                                }
-                            }
-                            lineLength++
-                            blankLine = false
+        var extractionErr error
+        if analyzed(file) {
+            contents, err := reads.next(file)
+            read := err == nil
+            if read {
+                // count the number of lines in the file.  if the file
+                // doesn't look like text, set the number of lines to a
+                // negative number.
+                weirdCharacters := 0
+                entry.lines = 1
+                blankLine := true
+                lineLength := 0
+                for i := 0; i < len(contents); i++ {
+                    switch contents[i] {
+                    case '\r':
+                        if i + 1 < len(contents) && contents[i + 1] == '\n' {
+                            i++
                         }
-                        if entry.lines < 0 {
-                            break
+                        fallthrough
+                    case '\n':
+                        entry.lines++
+                        if lineLength > entry.maximumLineLength {
+                            entry.maximumLineLength = lineLength
                         }
+                        lineLength = 0
+                        blankLine = true
+                    case 0:
+                        // this isn't utf-8 text.
+                        entry.lines = -1
+                    default:
+                        if contents[i] > 0xf4 {
+                            // this isn't utf-8 text, but some files in the
+                            // linux source tree use non-utf-8 codepages.
+                            // so we allow a few illegal characters through
+                            // (they'll show up as 0xFFFD on the web).
+                            weirdCharacters++
+                            if weirdCharacters > weirdCharacterLimit {
+                                entry.lines = -1
+                                break
+                            }
+                        }
+                        lineLength++
+                        blankLine = false
                     }
-                    if lineLength > entry.maximumLineLength {
-                        entry.maximumLineLength = lineLength
-                    }
-                    if blankLine {
-                        entry.lines--
-                    }
-                    if entry.lines >= 0 {
-                        searchIndex.addFile(entry.file.Name, contents)
+                    if entry.lines < 0 {
+                        break
                     }
                 }
+                if lineLength > entry.maximumLineLength {
+                    entry.maximumLineLength = lineLength
+                }
+                if blankLine {
+                    entry.lines--
+                }
+                if entry.lines >= 0 {
+                    searchIndex.addFile(entry.file.Name, contents)
+                }
             }
+            if extraction != nil {
+                // only text files and symlinks are read again.
+                if read && (entry.lines >= 0 || file.Mode() & os.ModeSymlink != 0) {
+                    extractionErr = extraction.store(entry, contents)
+                } else {
+                    extractionErr = extraction.copy(entry)
+                }
+            }
+        } else if entry.file != nil && extraction != nil {
+            extractionErr = extraction.copy(entry)
+        }
+        if extractionErr != nil {
+            return extractionErr
         }
         archive.mutex.Lock()
         if entry.file != nil {
@@ -434,70 +413,117 @@ func (c *cache) download(p page, format archiveFormat, protocol protocol, archiv
             archive.filesToRenderByName[entry.file.Name] = len(archive.filesToRender)
             archive.filesToRender = append(archive.filesToRender, entry)
         }
-        err := archive.addDirectoryEntry(entry, components)
+        err := archive.directories.add(entry, components)
         archive.progress.filesAnalyzed++
         archive.mutex.Unlock()
         if err != nil {
             return err
         }
     }
+    if err := searchIndex.finish(); err != nil {
+        return err
+    }
+    if extraction != nil {
+        extracted, err := extraction.finish()
+        if err != nil {
+            return err
+        }
+        archive.mutex.Lock()
+        if archive.zipReadCloser == nil {
+            // the archive was reclaimed out from under us.
+            err := archive.failureReason
+            archive.mutex.Unlock()
+            extracted.Close()
+            return err
+        }
+        for i, entry := range extraction.entries {
+            entry.file = extracted.File[i]
+        }
+        downloadedReadCloser, downloadedFileName := archive.zipReadCloser, archive.zipFileName
+        archive.zipReadCloser = extracted
+        archive.zipFileName = extraction.f.Name()
+        extraction = nil
+        archive.mutex.Unlock()
+        downloadedReadCloser.Close()
+        os.Remove(downloadedFileName)
+    }
     archive.mutex.Lock()
-    archive.progress.estimatedContentLength = archive.progress.downloadedContentLength
-    archive.progress.directories = len(archive.directories)
+    tree := archive.directories
+    archive.mutex.Unlock()
+    // sort the directories and discover any readme files.
+    tree.finish()
+    archive.mutex.Lock()
+    archive.progress.estimatedContentLength = atomic.LoadInt64(&archive.downloadedBytes)
+    archive.progress.directories = tree.numberOfDirectories
     // if there's only one directory entry in the root directory, set it as the
     // initial directory.
+    initialDirectory := int32(rootDirectoryNode)
     for {
-        dir := archive.directories[archive.initialDirectory]
-        if dir == nil || len(dir.entries) != 1 {
-            break
-        }
-        var name string
-        for name, _ = range dir.entries {}
-        if dir.entries[name].file != nil {
+        c := tree.childrenOf(initialDirectory)
+        if len(c) != 1 || !tree.nodes[c[0]].isDirectory {
             break
         }
-        archive.initialDirectory = path.Join(archive.initialDirectory, name)
+        initialDirectory = c[0]
     }
-    // first pass through the directories.  separate and sort directories and
-    // files and discover any readme files.
-    for _, v := range archive.directories {
-        archive.mutex.Unlock()
-        v.fileNames = []string{}
-        v.directoryNames = []string{}
-        for name, entry := range v.entries {
-            if entry.file == nil {
-                v.directoryNames = append(v.directoryNames, name)
-            } else {
-                v.fileNames = append(v.fileNames, name)
-                if entry.lines > 0 && useAsReadme(v, name) {
-                    v.readmeName = name
-                }
-            }
-        }
-        sort.Strings(v.fileNames)
-        sort.Strings(v.directoryNames)
-        archive.mutex.Lock()
-    }
-    // second pass through the directories.  render the directory index pages.
-    for k, _ := range archive.directories {
-        archive.mutex.Unlock()
-        if err := os.MkdirAll(fmt.Sprintf("%s%s/%s", c.rootPath, archive.path, k), 0755); err != nil {
+    archive.initialDirectory = tree.path(initialDirectory)
+    archive.mutex.Unlock()
+    // render the directory index pages, handing them to the file operation
+    // pool to be written out.  directories containing markdown files also
+    // get a directory under textPath for the renderers' textual versions.
+    var writes fileBatch
+    if len(tree.nodes) <= directoryManifestNodeLimit {
+        var b bytes.Buffer
+        mp := page{ isDirectory: true, archiveURL: p.archiveURL }
+        if err := mp.writeDirectoryManifest(&b, tree); err != nil {
             return err
         }
-        f, err := os.Create(fmt.Sprintf("%s%s/%s/%s", c.rootPath, archive.path, k, indexFileName))
-        if err != nil {
-            return err
+        writes.submit(func () error {
+            filename := path.Join(c.rootPath, archive.path, directoryManifestFileName)
+            return writeFileCreatingDirectory(filename, b.Bytes())
+        })
+    }
+    for id := range tree.nodes {
+        if !tree.nodes[id].isDirectory {
+            continue
         }
-        w := bufio.NewWriter(f)
+        k := tree.path(int32(id))
+        var b bytes.Buffer
         dp := page{ name: k, isDirectory: true, archiveURL: p.archiveURL }
-        dp.writeDirectoryPage(w, archive.directories)
-        w.Flush()
-        f.Close()
-        archive.mutex.Lock()
-        archive.notifyRendered(k)
-        archive.progress.renderedDirectories++
+        dp.writeDirectoryPage(&b, tree, int32(id))
+        hasMarkdown := false
+        for _, fileID := range tree.files(int32(id)) {
+            if isMarkdown(tree.nodes[fileID].name) {
+                hasMarkdown = true
+                break
+            }
+        }
+        writes.submit(func () error {
+            filename := fmt.Sprintf("%s%s/%s/%s", c.rootPath, archive.path, k, indexFileName)
+            if err := writeFileCreatingDirectory(filename, b.Bytes()); err != nil {
+                return err
+            }
+            if hasMarkdown {
+                if err := os.MkdirAll(path.Join(c.textPath, archive.path, k), 0755); err != nil {
+                    return err
+                }
+            }
+            archive.mutex.Lock()
+            archive.notifyRendered(k)
+            archive.progress.renderedDirectories++
+            archive.mutex.Unlock()
+            return nil
+        })
+    }
+    if err := writes.wait(); err != nil {
+        return err
     }
+    archive.mutex.Lock()
     // finish writing the metadata file.
+    manifest, err := json.Marshal(newArchiveManifest(archive.filesToRender))
+    if err != nil {
+        archive.mutex.Unlock()
+        return err
+    }
     metadata := archiveMetadata{
         Version: 1,
         ArchivePath: archive.path,
@@ -505,6 +531,7 @@ func (c *cache) download(p page, format archiveFormat, protocol protocol, archiv
         CreationTime: archive.creationTime,
         NumberOfFiles: len(rc.File),
         InitialDirectory: archive.initialDirectory,
+        Manifest: manifest,
     }
     if err := metadata.writeToFile(searchIndex.file); err != nil {
         archive.mutex.Unlock()
@@ -514,13 +541,19 @@ func (c *cache) download(p page, format archiveFormat, protocol protocol, archiv
     close(archive.downloaded)
 
     if len(archive.filesToRender) > 0 {
+        if err := os.MkdirAll(path.Join(c.rootPath, archive.path, renderTemporaryDirectoryName), 0755); err != nil {
+            archive.mutex.Unlock()
+            return err
+        }
         // the download is finished.  transition to the rendering state.
         archive.transitionToState(archiveStateRendering)
+        q := newRenderQueue(archive, p.archiveURL, c.renderQueuesCond)
+        archive.renderQueue = q
         archive.mutex.Unlock()
-        c.mutex.Lock()
-        c.renderingArchiveURLs = append(c.renderingArchiveURLs, p.archiveURL)
-        c.renderingCond.Broadcast()
-        c.mutex.Unlock()
+        c.renderQueuesMutex.Lock()
+        c.renderQueues = append(c.renderQueues, q)
+        c.renderQueuesCond.Broadcast()
+        c.renderQueuesMutex.Unlock()
     } else {
         // there aren't any files to render, so transition to the finished state
         // directly (the renderers won't do it unless they actually finish
@@ -536,7 +569,7 @@ func findInvalidComponent(components []string) string {
     for _, v := range components {
         if v == "." || v == ".." {
             return v
-        } else if v == indexFileName {
+        } else if v == indexFileName || v == directoryManifestFileName || v == renderTemporaryDirectoryName {
             invalidComponent = v
         }
     }
@@ -555,7 +588,8 @@ func defaultContentType(entry *archiveDirectoryEntry) contentType {
     }
 }
 
-func useAsReadme(dir *archiveDirectory, name string) bool {
+// should name be shown as the readme instead of the current choice, readme?
+func useAsReadme(readme string, name string) bool {
     lower := strings.ToLower(name)
     if !strings.Contains(lower, "readme") {
         return false
@@ -564,22 +598,22 @@ func useAsReadme(dir *archiveDirectory, name string) bool {
     if strings.HasSuffix(lower, ".html") || strings.HasSuffix(lower, ".htm") {
         return false
     }
-    if dir.readmeName == "" {
+    if readme == "" {
         return true
     }
     // prefer markdown readme files.
-    if isMarkdown(name) && !isMarkdown(dir.readmeName) {
+    if isMarkdown(name) && !isMarkdown(readme) {
         return true
-    } else if !isMarkdown(name) && isMarkdown(dir.readmeName) {
+    } else if !isMarkdown(name) && isMarkdown(readme) {
         return false
     }
     // otherwise, prefer shorter file names.
-    if len(name) < len(dir.readmeName) {
+    if len(name) < len(readme) {
         return true;
-    } else if len(name) > len(dir.readmeName) {
+    } else if len(name) > len(readme) {
         return false;
     }
-    return strings.Compare(name, dir.readmeName) >= 0
+    return strings.Compare(name, readme) >= 0
 }
 
 type progressWriter struct {
@@ -587,12 +621,9 @@ type progressWriter struct {
 }
 func (w progressWriter) Write(p []byte) (n int, err error) {
     n = len(p)
-    w.ar.mutex.Lock()
-    w.ar.progress.downloadedContentLength += int64(n)
-    if w.ar.progress.downloadedContentLength > archiveSizeLimit {
+    if atomic.AddInt64(&w.ar.downloadedBytes, int64(n)) > archiveSizeLimit {
         err = fmt.Errorf("archive exceeded maximum size of %d bytes", archiveSizeLimit)
     }
-    w.ar.mutex.Unlock()
     return
 }
 
@@ -605,6 +636,9 @@ type archiveMetadata struct {
     CreationTime time.Time
     NumberOfFiles int
     InitialDirectory string
+    // an encoded []archiveManifestEntry.  it's only decoded when comparing
+    // archives, so loading the cache at startup doesn't pay for it.
+    Manifest json.RawMessage
 }
 
 func (m archiveMetadata) writeToFile(file *os.File) error {
@@ -713,7 +747,10 @@ func (c *cache) archiveMetadataPath(archivePath string) string {
     return path.Join(c.metaPath, metadataPath)
 }
 
-func loadArchivesFromMetadata(metaPath string) (map[string]*archive, error) {
+// removeInvalid removes metadata files which can't be read.  a process
+// taking over from one being restarted (see restart.go) keeps them, since they
+// might belong to archives the other process is still working on.
+func loadArchivesFromMetadata(metaPath string, removeInvalid bool) (map[string]*archive, error) {
     // iterate over all the files in the cache's metaPath, creating an archive
     // for each valid metadata file.
     archivesByURL := make(map[string]*archive)
@@ -728,37 +765,279 @@ func loadArchivesFromMetadata(metaPath string) (map[string]*archive, error) {
         if err != nil {
             return nil, err
         }
-        metadata, err := readMetadata(file)
+        archiveURL, ar, err := archiveFromMetadata(file, path)
         file.Close()
         if err != nil {
-            log.Print("metadata read error: ", err)
-            os.Remove(path)
+            if removeInvalid {
+                log.Print(err)
+                os.Remove(path)
+            }
             continue
         }
-        searchIndex, err := openSearchIndex(path, metadata.NumberOfFiles)
-        if err != nil {
-            log.Print("search index read error: ", err)
-            os.Remove(path)
+        archivesByURL[archiveURL] = ar
+    }
+    return archivesByURL, nil
+}
+
+// returns the url and finished archive described by the metadata file at
+// path.
+func archiveFromMetadata(file *os.File, path string) (string, *archive, error) {
+    metadata, err := readMetadata(file)
+    if err != nil {
+        return "", nil, fmt.Errorf("metadata read error: %v", err)
+    }
+    searchIndex, err := openSearchIndex(path, metadata.NumberOfFiles)
+    if err != nil {
+        return "", nil, fmt.Errorf("search index read error: %v", err)
+    }
+    return metadata.ArchiveURL, &archive{
+        state: archiveStateFinished,
+        path: metadata.ArchivePath,
+        creationTime: metadata.CreationTime,
+        initialDirectory: metadata.InitialDirectory,
+        downloaded: closedChannel,
+        searchIndex: searchIndex,
+    }, nil
+}
+
+// -- render queues
+
+// the number of requested files which can be waiting to jump ahead of the
+// rest of an archive.  requests beyond this just wait their turn.
+const renderPriorityQueueLength = 64
+
+// if a requested file hasn't been rendered after this long, a plain version
+// without syntax highlighting is shown until it is.
+const plainRenderDelay = 250 * time.Millisecond
+
+
+// the files of an archive in the rendering state.  renderers claim files from
+// the queue without taking the archive's mutex: files are claimed in order by
+// incrementing next, or out of order through the priority channel.  either
+// way, claimed[i] is set to make sure each file is only rendered once.
+//
+// large files which don't fit in the memory budget are put aside on the
+// deferred list and rendered after everything else.
+type renderQueue struct {
+    // these are accessed atomically.  (they come first to keep them 64-bit
+    // aligned.)
+    next int64
+    filesLeft int64
+    temporaryFiles int64
+    stopped int32
+    deferredFiles int32
+
+    archive *archive
+    archiveURL string
+    zipFileName string
+
+    // these don't change once the queue is created.
+    files []*archiveDirectoryEntry
+    indexByName map[string]int
+    claimed []int32
+
+    priority chan int
+    // the cache's renderQueuesCond, broadcast when a file is prioritized, so
+    // an idle interactive renderer picks it up.
+    prioritized *sync.Cond
+
+    deferredMutex sync.Mutex
+    deferred []int
+
+    // which version of each file has been written.  protected by the
+    // archive's mutex.
+    versions []fileVersion
+}
+
+type fileVersion uint8
+const (
+    versionNone fileVersion = iota
+    versionPlainInProgress
+    versionPlain
+    versionHighlighted
+)
+
+// values of renderQueue.claimed.
+const (
+    fileUnclaimed int32 = iota
+    fileClaimed
+    fileDeferred
+)
+
+// call with ar.mutex held.
+func newRenderQueue(ar *archive, archiveURL string, prioritized *sync.Cond) *renderQueue {
+    return &renderQueue{
+        filesLeft: int64(len(ar.filesToRender)),
+        archive: ar,
+        archiveURL: archiveURL,
+        zipFileName: ar.zipFileName,
+        files: ar.filesToRender,
+        indexByName: ar.filesToRenderByName,
+        claimed: make([]int32, len(ar.filesToRender)),
+        versions: make([]fileVersion, len(ar.filesToRender)),
+        priority: make(chan int, renderPriorityQueueLength),
+        prioritized: prioritized,
+    }
+}
+
+// returns a new name in the archive's renderTemporaryDirectoryName to render
+// to.  the names are short and can't collide with the archive's files, unlike
+// suffixed versions of their names.
+func (c *cache) temporaryRenderFileName(q *renderQueue) string {
+    n := atomic.AddInt64(&q.temporaryFiles, 1)
+    return path.Join(c.rootPath, q.archive.path, renderTemporaryDirectoryName, strconv.FormatInt(n, 10))
+}
+
+func (q *renderQueue) hasWork() bool {
+    if atomic.LoadInt32(&q.stopped) != 0 {
+        return false
+    }
+    return atomic.LoadInt64(&q.next) < int64(len(q.files)) || len(q.priority) > 0 || atomic.LoadInt32(&q.deferredFiles) > 0
+}
+
+// move a file to the front of the queue, unless it's already been claimed.
+// deferred files can be prioritized, since someone's waiting on them.
+func (q *renderQueue) prioritize(name string) {
+    index, ok := q.indexByName[name]
+    if !ok || atomic.LoadInt32(&q.claimed[index]) == fileClaimed {
+        return
+    }
+    select {
+    case q.priority <- index:
+        q.prioritized.L.Lock()
+        q.prioritized.Broadcast()
+        q.prioritized.L.Unlock()
+    default:
+    }
+}
+
+// returns the index of the next file to render, or -1 if there aren't any
+// left (or, if priorityOnly, no priority files).  priority and deferred files
+// shouldn't be deferred (again).
+func (q *renderQueue) claim(priorityOnly bool) (index int, isPriority bool, wasDeferred bool) {
+    for atomic.LoadInt32(&q.stopped) == 0 {
+        select {
+        case i := <-q.priority:
+            if atomic.CompareAndSwapInt32(&q.claimed[i], fileUnclaimed, fileClaimed) ||
+             atomic.CompareAndSwapInt32(&q.claimed[i], fileDeferred, fileClaimed) {
+                return i, true, false
+            }
+            continue
+        default:
+        }
+        if priorityOnly {
+            break
+        }
+        i := atomic.AddInt64(&q.next, 1) - 1
+        if i < int64(len(q.files)) {
+            if atomic.CompareAndSwapInt32(&q.claimed[i], fileUnclaimed, fileClaimed) {
+                return int(i), false, false
+            }
             continue
         }
-        archivesByURL[metadata.ArchiveURL] = &archive{
-            state: archiveStateFinished,
-            path: metadata.ArchivePath,
-            creationTime: metadata.CreationTime,
-            initialDirectory: metadata.InitialDirectory,
-            downloaded: closedChannel,
-            searchIndex: searchIndex,
+        // everything else has been claimed -- move on to the deferred files.
+        q.deferredMutex.Lock()
+        if len(q.deferred) == 0 {
+            q.deferredMutex.Unlock()
+            break
+        }
+        d := q.deferred[0]
+        q.deferred = q.deferred[1:]
+        atomic.AddInt32(&q.deferredFiles, -1)
+        q.deferredMutex.Unlock()
+        // skip files which were prioritized in the meantime.
+        if atomic.CompareAndSwapInt32(&q.claimed[d], fileDeferred, fileClaimed) {
+            return d, false, true
         }
     }
-    return archivesByURL, nil
+    return -1, false, false
+}
+
+// give back a claimed file, to be rendered after everything else.  the file
+// is marked deferred before it's added to the list, so prioritize() can't see
+// it as claimed once it's there.
+func (q *renderQueue) deferFile(index int) {
+    q.deferredMutex.Lock()
+    atomic.StoreInt32(&q.claimed[index], fileDeferred)
+    q.deferred = append(q.deferred, index)
+    atomic.AddInt32(&q.deferredFiles, 1)
+    q.deferredMutex.Unlock()
+}
+
+// wait for an archive with files to render (or, if priorityOnly, priority
+// files).  archives with more priority files go first; otherwise, the archive
+// which began rendering first does.
+func (c *cache) nextRenderQueue(priorityOnly bool) *renderQueue {
+    c.renderQueuesMutex.Lock()
+    defer c.renderQueuesMutex.Unlock()
+    for {
+        var best *renderQueue
+        priorityFiles := -1
+        // remove any finished queues while looking.
+        queues := c.renderQueues[:0]
+        for _, q := range c.renderQueues {
+            if !q.hasWork() {
+                continue
+            }
+            queues = append(queues, q)
+            if len(q.priority) > priorityFiles && (len(q.priority) > 0 || !priorityOnly) {
+                best = q
+                priorityFiles = len(q.priority)
+            }
+        }
+        for i := len(queues); i < len(c.renderQueues); i++ {
+            c.renderQueues[i] = nil
+        }
+        c.renderQueues = queues
+        if best != nil {
+            return best
+        }
+        // if there's nothing to render, block until there is.
+        c.renderQueuesCond.Wait()
+    }
 }
 
 // -- renderer
 
 type renderer struct {
-    highlighter *tm.Highlighter
+    worker *renderWorker
+}
+func newRenderer() (*renderer, error) {
+    r := &renderer{ worker: &renderWorker{} }
+    // start the worker right away so problems with the syntax definitions are
+    // reported at startup.
+    if err := r.worker.start(); err != nil {
+        return nil, err
+    }
+    return r, nil
 }
-func newRenderer(syntaxDefinitionPaths []string) *renderer {
+
+// the paths of the tmlanguage files in the DEZIP_SYNTAX directory.
+func syntaxDefinitionPaths() []string {
+    var paths []string
+    if syntaxEnv, ok := os.LookupEnv("DEZIP_SYNTAX"); ok {
+        files, err := ioutil.ReadDir(syntaxEnv)
+        if err != nil {
+            log.Fatal(err)
+        }
+        for _, file := range files {
+            paths = append(paths, path.Join(syntaxEnv, file.Name()))
+        }
+    }
+    return paths
+}
+
+// syntax highlighting comes in two tiers.  files get the full grammars if
+// they can, but big files, files with long lines, and files the full
+// grammars are too slow for get the reduced ones (see tm.ReduceLanguages),
+// which only pick out comments, strings, numbers, and keywords.  that's most
+// of the color on a page, at a fraction of the cost.
+type highlighters struct {
+    full *tm.Highlighter
+    reduced *tm.Highlighter
+}
+
+func newHighlighters(syntaxDefinitionPaths []string) (*highlighters, error) {
     languages := make([]*tm.Language, len(syntaxDefinitionPaths))
     for i, _ := range languages {
         rc, err := os.Open(syntaxDefinitionPaths[i])
@@ -772,98 +1051,198 @@ func newRenderer(syntaxDefinitionPaths []string) *renderer {
             log.Print("error loading ", syntaxDefinitionPaths[i], ": ", err)
         }
     }
-    h, err := tm.NewHighlighter(languages, highlightScopeForScopeName)
+    full, err := tm.NewHighlighter(languages, highlightScopeForScopeName)
     if err != nil {
-        log.Fatal(err)
+        return nil, err
     }
-    return &renderer{h}
+    reduced, err := tm.NewHighlighter(tm.ReduceLanguages(languages), highlightScopeForScopeName)
+    if err != nil {
+        return nil, err
+    }
+    return &highlighters{ full: full, reduced: reduced }, nil
 }
-func (r *renderer) renderLoop(c *cache) {
-    for {
-        c.mutex.Lock()
-        var ar *archive
-        var archiveURL string
-        for ar == nil {
-            // prioritize archives with more priorityFiles.  if two archives
-            // have the same number of priorityFiles, render from the one that
-            // began rendering first (appears earlier in the list).
-            priorityFiles := -1
-            // remove any out-of-date archive URLs by building a new list here.
-            renderingArchiveURLs := []string{}
-            for _, url := range c.renderingArchiveURLs {
-                v := c.archivesByURL[url]
-                if v == nil || v.state != archiveStateRendering {
-                    continue
-                }
-                renderingArchiveURLs = append(renderingArchiveURLs, url)
-                v.mutex.Lock()
-                if v.nextFileToRender < len(v.filesToRender) && v.priorityFiles > priorityFiles {
-                    ar = v
-                    archiveURL = url
-                    priorityFiles = v.priorityFiles
-                }
-                v.mutex.Unlock()
-            }
-            c.renderingArchiveURLs = renderingArchiveURLs
-            if ar == nil {
-                // if there's nothing to render, block until there is.
-                c.renderingCond.Wait()
-            }
-        }
-        c.mutex.Unlock()
 
-        ar.mutex.Lock()
-        // since the lock wasn't held this whole time, check again that this
-        // archive has files to render.
-        if ar.state != archiveStateRendering || ar.nextFileToRender >= len(ar.filesToRender) {
-            ar.mutex.Unlock()
+// returns the highlighter for entry (nil for none), and when to give up on
+// it and start over with the reduced grammars (zero for never).
+func (hs *highlighters) forEntry(entry *archiveDirectoryEntry, reducedFidelity bool) (*tm.Highlighter, time.Time) {
+    if hs == nil || entry.maximumLineLength > reducedLineLengthLimit {
+        return nil, time.Time{}
+    }
+    if reducedFidelity || entry.maximumLineLength > lineLengthLimit || entry.file.UncompressedSize64 > fullHighlightSizeLimit {
+        return hs.reduced, time.Time{}
+    }
+    return hs.full, time.Now().Add(fullHighlightTimeLimit)
+}
+// the interactive renderer only renders files someone has requested.  the
+// others take turns under the render controller, if there is one (see
+// renderers.go).
+func (r *renderer) renderLoop(c *cache, interactive bool) {
+    for {
+        if interactive || c.renderers == nil {
+            r.renderNext(c, interactive)
             continue
         }
-        // take responsibility for rendering the next file in the list.
-        fileToRender := ar.filesToRender[ar.nextFileToRender]
-        ar.nextFileToRender++
-        if ar.priorityFiles > 0 {
-            log.Print("rendering priority file: ", fileToRender.file.Name)
-            ar.priorityFiles--
-        }
-        ar.filesBeingRendered++
-        ar.mutex.Unlock()
+        c.renderers.acquire()
+        r.renderNext(c, interactive)
+        c.renderers.release()
+    }
+}
 
-        // actually render the file.
-        contentType := defaultContentType(fileToRender)
-        err := r.render(path.Join(c.rootPath, ar.path, fileToRender.file.Name), archiveURL, fileToRender, contentType)
-        if err != nil {
-            log.Print("error during render(): ", err)
-        }
-        // render markdown files a second time as text so they can be searched.
-        if contentType != contentTypeText {
-            filename := path.Join(c.textPath, ar.path, fileToRender.file.Name)
-            err := os.MkdirAll(path.Dir(filename), 0755)
-            if err == nil {
-                err = r.render(filename, archiveURL, fileToRender, contentTypeText)
-            }
-            if err != nil {
-                log.Print("error during textual render(): ", err)
-            }
+func (r *renderer) renderNext(c *cache, interactive bool) {
+    q := c.nextRenderQueue(interactive)
+    index, isPriority, wasDeferred := q.claim(interactive)
+    if index < 0 {
+        return
+    }
+    fileToRender := q.files[index]
+
+    // reserve memory for the render.  small files just wait for it, as do
+    // files someone is waiting on.  large files are deferred if there
+    // isn't enough available right now.
+    var reserved int64
+    estimate := renderMemoryEstimate(fileToRender)
+    if isPriority || wasDeferred || estimate <= memory.total / largeRenderFraction {
+        reserved = memory.reserve(estimate)
+    } else if n, ok := memory.tryReserve(estimate); ok {
+        reserved = n
+    } else {
+        log.Printf("deferring render of %s until memory is available", fileToRender.file.Name)
+        q.deferFile(index)
+        return
+    }
+    if isPriority {
+        log.Print("rendering priority file: ", fileToRender.file.Name)
+    }
+
+    // actually render the file.  text files might have a plain version
+    // in place already (see renderPlainVersion), so they're rendered to a
+    // temporary file and swapped in afterwards.
+    contentType := defaultContentType(fileToRender)
+    filename := path.Join(c.rootPath, q.archive.path, fileToRender.file.Name)
+    outputFileName := filename
+    if contentType == contentTypeText {
+        outputFileName = c.temporaryRenderFileName(q)
+    }
+    err := r.render(outputFileName, q.archiveURL, q.zipFileName, fileToRender, contentType)
+    if err != nil {
+        log.Print("error during render(): ", err)
+    }
+    // render markdown files a second time as text so they can be searched.
+    if contentType != contentTypeText {
+        // (the directory was created along with the directory pages.)
+        filename := path.Join(c.textPath, q.archive.path, fileToRender.file.Name)
+        if err := r.render(filename, q.archiveURL, q.zipFileName, fileToRender, contentTypeText); err != nil {
+            log.Print("error during textual render(): ", err)
         }
+    }
 
-        ar.mutex.Lock()
+    memory.release(reserved)
+
+    finished := atomic.AddInt64(&q.filesLeft, -1) == 0
+    ar := q.archive
+    ar.mutex.Lock()
+    if outputFileName != filename {
         if ar.state != archiveStateRendering {
-            ar.mutex.Unlock()
-            continue
+            os.Remove(outputFileName)
+        } else if err := os.Rename(outputFileName, filename); err != nil {
+            log.Print(err)
         }
-        ar.filesBeingRendered--
+        q.versions[index] = versionHighlighted
+    }
+    if ar.state == archiveStateRendering {
         // signal to any waiting goroutines that the file has rendered.
         ar.notifyRendered(fileToRender.file.Name)
-        // check whether rendering is finished.
-        if ar.filesBeingRendered == 0 && ar.nextFileToRender >= len(ar.filesToRender) {
+        if finished {
+            os.Remove(path.Join(c.rootPath, ar.path, renderTemporaryDirectoryName))
             ar.transitionToState(archiveStateFinished)
         }
+    }
+    ar.mutex.Unlock()
+}
+
+// write a version of a text file without syntax highlighting, so someone
+// waiting on the file can see it before the renderers get to it.  the
+// highlighted version replaces it once it's ready.  highlighting can run into
+// pathological regexes, but escaping text is quick and happens in this
+// process.
+func (c *cache) renderPlainVersion(ar *archive, archiveURL string, name string) {
+    ar.mutex.Lock()
+    q := ar.renderQueue
+    index, ok := -1, false
+    if ar.state == archiveStateRendering && q != nil {
+        index, ok = q.indexByName[name]
+    }
+    if !ok || q.versions[index] != versionNone || defaultContentType(q.files[index]) != contentTypeText {
         ar.mutex.Unlock()
+        return
+    }
+    q.versions[index] = versionPlainInProgress
+    ar.mutex.Unlock()
+
+    entry := q.files[index]
+    filename := path.Join(c.rootPath, ar.path, name)
+    temporaryFileName := c.temporaryRenderFileName(q)
+    reserved := memory.reserve(renderMemoryEstimate(entry))
+    err := renderPage(temporaryFileName, archiveURL, entry, contentTypeText, nil, false)
+    memory.release(reserved)
+
+    ar.mutex.Lock()
+    defer ar.mutex.Unlock()
+    if err != nil || ar.state != archiveStateRendering || q.versions[index] != versionPlainInProgress {
+        // the highlighted version won the race (or the archive went away).
+        os.Remove(temporaryFileName)
+        if q.versions[index] == versionPlainInProgress {
+            q.versions[index] = versionNone
+        }
+        return
+    }
+    if err := os.Rename(temporaryFileName, filename); err != nil {
+        log.Print(err)
+        q.versions[index] = versionNone
+        return
+    }
+    q.versions[index] = versionPlain
+    ar.notifyRendered(name)
+}
+
+func (r *renderer) render(filename string, archiveURL string, zipFileName string, entry *archiveDirectoryEntry, contentType contentType) error {
+    job := renderJob{
+        ZipFileName: zipFileName,
+        EntryName: entry.file.Name,
+        Lines: entry.lines,
+        MaximumLineLength: entry.maximumLineLength,
+        ArchiveURL: archiveURL,
+        OutputFileName: filename,
+        ContentType: contentType,
+    }
+    for attempt := 1; attempt <= renderJobAttempts; attempt++ {
+        result, err := r.worker.run(job)
+        if err == nil {
+            if len(result.Error) > 0 {
+                return errors.New(result.Error)
+            }
+            return nil
+        }
+        log.Printf("render worker failed on %s (attempt %d of %d): %v", entry.file.Name, attempt, renderJobAttempts, err)
+        job.ReducedFidelity = true
+    }
+    // this file keeps taking down workers.  render it without syntax
+    // highlighting, which doesn't involve oniguruma at all.
+    return renderPage(filename, archiveURL, entry, contentType, nil, false)
+}
+
+// renders with the highlighter from hs chosen for entry, or none if hs is nil.
+func renderPage(filename string, archiveURL string, entry *archiveDirectoryEntry, contentType contentType, hs *highlighters, reducedFidelity bool) error {
+    h, deadline := hs.forEntry(entry, reducedFidelity)
+    err := writePage(filename, archiveURL, entry, contentType, h, deadline)
+    if err == errHighlightTooSlow {
+        log.Printf("%s took longer than %v to highlight; using the reduced grammars", entry.file.Name, fullHighlightTimeLimit)
+        err = writePage(filename, archiveURL, entry, contentType, hs.reduced, time.Time{})
     }
+    return err
 }
 
-func (r *renderer) render(filename string, archiveURL string, entry *archiveDirectoryEntry, contentType contentType) (err error) {
+func writePage(filename string, archiveURL string, entry *archiveDirectoryEntry, contentType contentType, h *tm.Highlighter, deadline time.Time) (err error) {
     defer func () {
         if r := recover(); r != nil {
             err = fmt.Errorf("panic during render: %v\n%v", r, string(debug.Stack()))
@@ -879,6 +1258,6 @@ func (r *renderer) render(filename string, archiveURL string, entry *archiveDire
     w := bufio.NewWriter(f)
     defer w.Flush()
     p := page{ name: entry.file.Name, archiveURL: archiveURL }
-    p.writeFilePage(w, r.highlighter, entry, contentType)
+    err = p.writeFilePage(w, h, deadline, entry, contentType)
     return
 }
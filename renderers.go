@@ -0,0 +1,183 @@
+package main
+
+import (
+    "bufio"
+    "fmt"
+    "os"
+    "runtime"
+    "strconv"
+    "strings"
+    "sync"
+    "time"
+)
+
+// rendering whole archives in the background should soak up idle cores, but
+// not at the expense of the pages people are waiting for.  one renderer, the
+// interactive one, only renders files someone has requested, so there's
+// always a renderer free for them.  the rest work through archives (also
+// taking requested files first), but only as many at once as the render
+// controller allows.
+//
+// every renderControlInterval, the controller halves the number of
+// background renderers if too many requests had to wait longer than
+// plainRenderDelay for their file (and were shown the plain version), and
+// otherwise adds one if there's work waiting, every background renderer is
+// busy, and a core is idle.  there's always at least one background
+// renderer, so archives keep moving.
+const renderControlInterval = 2 * time.Second
+
+// the fraction of requests which can miss plainRenderDelay before background
+// rendering is cut back.
+const renderLatencyMissFraction = 0.1
+
+// background renderers are only added while at least this many cores are
+// idle.
+const renderIdleCoresToGrow = 1.0
+
+type renderController struct {
+    mutex sync.Mutex
+    cond *sync.Cond
+    // the number of background renderers allowed to run at once, how many
+    // are running, and the most there can be.
+    limit int
+    running int
+    maximum int
+    // requests which waited on a render since the last adjustment, and how
+    // many of them waited past plainRenderDelay.
+    waits int
+    misses int
+    // cpu time counters as of the last adjustment.
+    idleTicks uint64
+    totalTicks uint64
+}
+
+// starts the interactive renderer, and a background renderer for each of the
+// other cpus.
+func (c *cache) startRenderers() error {
+    maximum := runtime.NumCPU() - 1
+    if maximum < 1 {
+        maximum = 1
+    }
+    c.renderers = &renderController{ limit: 1, maximum: maximum }
+    c.renderers.cond = sync.NewCond(&c.renderers.mutex)
+    c.renderers.idleTicks, c.renderers.totalTicks, _ = cpuTicks()
+    for i := 0; i <= maximum; i++ {
+        r := &renderer{ worker: &renderWorker{} }
+        if i < 2 {
+            // the renderers which run from the start get their workers right
+            // away, so problems with the syntax definitions are reported at
+            // startup.  the others start theirs when they're first needed.
+            var err error
+            if r, err = newRenderer(); err != nil {
+                return err
+            }
+        }
+        go r.renderLoop(c, i == 0)
+    }
+    go c.renderers.controlLoop(c)
+    return nil
+}
+
+func (rc *renderController) acquire() {
+    rc.mutex.Lock()
+    for rc.running >= rc.limit {
+        rc.cond.Wait()
+    }
+    rc.running++
+    rc.mutex.Unlock()
+}
+
+func (rc *renderController) release() {
+    rc.mutex.Lock()
+    rc.running--
+    rc.cond.Broadcast()
+    rc.mutex.Unlock()
+}
+
+// records how long a request waited for its file to render.  waits are cut
+// off at plainRenderDelay.
+func (rc *renderController) observeWait(wait time.Duration) {
+    rc.mutex.Lock()
+    rc.waits++
+    if wait >= plainRenderDelay {
+        rc.misses++
+    }
+    rc.mutex.Unlock()
+}
+
+func (rc *renderController) controlLoop(c *cache) {
+    for {
+        time.Sleep(renderControlInterval)
+        c.renderQueuesMutex.Lock()
+        backgroundWork := false
+        for _, q := range c.renderQueues {
+            if q.hasWork() {
+                backgroundWork = true
+                break
+            }
+        }
+        c.renderQueuesMutex.Unlock()
+        rc.adjust(backgroundWork)
+    }
+}
+
+func (rc *renderController) adjust(backgroundWork bool) {
+    // without cpu counters, only latency holds background rendering back.
+    idleCores := renderIdleCoresToGrow
+    idle, total, err := cpuTicks()
+    if err == nil && total > rc.totalTicks {
+        idleCores = float64(idle - rc.idleTicks) / float64(total - rc.totalTicks) * float64(runtime.NumCPU())
+        rc.idleTicks, rc.totalTicks = idle, total
+    }
+    rc.mutex.Lock()
+    defer rc.mutex.Unlock()
+    limit := rc.limit
+    if rc.misses > 0 && float64(rc.misses) > renderLatencyMissFraction * float64(rc.waits) {
+        limit /= 2
+    } else if backgroundWork && rc.running >= rc.limit && idleCores >= renderIdleCoresToGrow {
+        limit++
+    }
+    if limit < 1 {
+        limit = 1
+    } else if limit > rc.maximum {
+        limit = rc.maximum
+    }
+    rc.limit = limit
+    rc.waits, rc.misses = 0, 0
+    rc.cond.Broadcast()
+}
+
+// returns the idle and total cpu time, in ticks, of all cpus since boot, from
+// /proc/stat.
+func cpuTicks() (idle uint64, total uint64, err error) {
+    f, err := os.Open("/proc/stat")
+    if err != nil {
+        return 0, 0, err
+    }
+    defer f.Close()
+    scanner := bufio.NewScanner(f)
+    if !scanner.Scan() {
+        return 0, 0, fmt.Errorf("/proc/stat is empty")
+    }
+    fields := strings.Fields(scanner.Text())
+    if len(fields) < 5 || fields[0] != "cpu" {
+        return 0, 0, fmt.Errorf("unexpected /proc/stat line %q", scanner.Text())
+    }
+    // user, nice, system, idle, iowait, irq, softirq, and steal.  the guest
+    // times after those are already counted in user and nice.
+    for i, field := range fields[1:] {
+        if i >= 8 {
+            break
+        }
+        n, err := strconv.ParseUint(field, 10, 64)
+        if err != nil {
+            return 0, 0, err
+        }
+        total += n
+        // idle and iowait.
+        if i == 3 || i == 4 {
+            idle += n
+        }
+    }
+    return idle, total, nil
+}
@@ -0,0 +1,488 @@
+package main
+
+import (
+    "context"
+    "crypto/rand"
+    "encoding/hex"
+    "encoding/json"
+    "fmt"
+    "io"
+    "log"
+    "net"
+    "net/http"
+    "net/http/httputil"
+    "net/url"
+    "os"
+    "os/exec"
+    "os/signal"
+    "strings"
+    "syscall"
+    "time"
+)
+
+// deploying a new binary shouldn't cost the archives being downloaded and
+// rendered.  on SIGHUP, dezip starts the binary again as its successor,
+// handing over the listening socket, so connections are never refused.  once
+// the successor has loaded the cache and started its renderers, it asks the
+// old process (its predecessor) to hand off.  the predecessor stops accepting
+// connections, finishes the requests it's serving, and sends the successor
+// its most requested pages and the archives it's still working on.
+//
+// those archives stay with the predecessor until they're finished: the
+// successor forwards requests for them to it, over a private loopback
+// listener.  as each one finishes, the successor loads it from the meta
+// directory like any other cached archive.  once they're all done (or after
+// restartDrainLimit, when whatever's left is reclaimed), the predecessor
+// exits.  if the successor fails to start, the predecessor carries on as if
+// nothing happened.
+//
+// SIGINT and SIGTERM stop accepting connections and let the requests in
+// progress finish before reclaiming unfinished archives and exiting.
+
+// the successor finds its predecessor's handoff url here, and inherits the
+// listening socket as file descriptor 3.
+const predecessorEnv = "DEZIP_PREDECESSOR"
+const inheritedListenerFD = 3
+
+// the path the successor requests from its predecessor to take over.
+const restartHandoffPath = "/restart.from.dezip"
+
+// how long requests in progress get to finish when the server stops
+// accepting connections.  a little longer than a request waits for a render.
+const shutdownRequestLimit = 15 * time.Second
+
+// how long the predecessor keeps working on unfinished archives.
+const restartDrainLimit = 20 * time.Minute
+
+// how often the predecessor checks on its unfinished archives.
+const restartPollInterval = 250 * time.Millisecond
+
+// sent by the predecessor as a stream of json messages.  the first lists the
+// archives it's still working on, the archives it has finished, and its hot
+// pages (most recently used first).  each later message releases one of the
+// unfinished archives, once the predecessor is done with it.  the stream ends
+// when the predecessor exits.
+type restartHandoffMessage struct {
+    Archives []restartHandoffArchive
+    Finished []restartHandoffArchive
+    HotPages []restartHandoffPage
+    Released *restartHandoffArchive
+}
+
+type restartHandoffArchive struct {
+    URL string
+    Path string
+}
+
+type restartHandoffPage struct {
+    Key string
+    ArchiveURL string
+    Body []byte
+    Gzipped []byte
+}
+
+// returns the socket inherited from a predecessor, or a new one listening on
+// address.
+func listen(address string) (net.Listener, error) {
+    if os.Getenv(predecessorEnv) == "" {
+        return net.Listen("tcp", address)
+    }
+    f := os.NewFile(inheritedListenerFD, "listener")
+    defer f.Close()
+    return net.FileListener(f)
+}
+
+func (c *cache) handleSignals(server *http.Server, listener net.Listener) {
+    signals := make(chan os.Signal, 1)
+    signal.Notify(signals, syscall.SIGINT, syscall.SIGTERM, syscall.SIGHUP)
+    for s := range signals {
+        if s == syscall.SIGHUP {
+            if err := c.startSuccessor(server, listener); err != nil {
+                log.Print("restart failed: ", err)
+            }
+            continue
+        }
+        ctx, cancel := context.WithTimeout(context.Background(), shutdownRequestLimit)
+        server.Shutdown(ctx)
+        cancel()
+        c.reclaimUnfinishedArchives()
+        os.Exit(0)
+    }
+}
+
+// -- predecessor side
+
+// the process started by a restart, as seen by its predecessor.
+type successor struct {
+    cache *cache
+    // the main server, shut down when the successor takes over.
+    server *http.Server
+    // serves the successor's handoff request and the requests it forwards.
+    handoffServer *http.Server
+    // the successor proves it was started by this process with this token.
+    token string
+    // closed once the main server is shut down.
+    shutDown chan struct{}
+}
+
+func (c *cache) startSuccessor(server *http.Server, listener net.Listener) error {
+    c.mutex.Lock()
+    busy := c.successor != nil || c.predecessorArchives != nil
+    c.mutex.Unlock()
+    if busy {
+        return fmt.Errorf("a restart is already in progress")
+    }
+    tcpListener, ok := listener.(*net.TCPListener)
+    if !ok {
+        return fmt.Errorf("can't hand off a %T", listener)
+    }
+    listenerFile, err := tcpListener.File()
+    if err != nil {
+        return err
+    }
+    defer listenerFile.Close()
+    token := make([]byte, 16)
+    if _, err := rand.Read(token); err != nil {
+        return err
+    }
+    handoffListener, err := net.Listen("tcp", "127.0.0.1:0")
+    if err != nil {
+        return err
+    }
+    s := &successor{
+        cache: c,
+        server: server,
+        token: hex.EncodeToString(token),
+        shutDown: make(chan struct{}),
+    }
+    s.handoffServer = &http.Server{ Handler: s }
+    go s.handoffServer.Serve(handoffListener)
+
+    executable, err := os.Executable()
+    if err != nil {
+        s.handoffServer.Close()
+        return err
+    }
+    cmd := exec.Command(executable, os.Args[1:]...)
+    cmd.Stdout = os.Stdout
+    cmd.Stderr = os.Stderr
+    // inheritedListenerFD is the first of the extra files.
+    cmd.ExtraFiles = []*os.File{ listenerFile }
+    for _, v := range os.Environ() {
+        if !strings.HasPrefix(v, predecessorEnv + "=") {
+            cmd.Env = append(cmd.Env, v)
+        }
+    }
+    cmd.Env = append(cmd.Env, fmt.Sprintf("%s=http://%s%s?token=%s", predecessorEnv, handoffListener.Addr(), restartHandoffPath, s.token))
+    c.mutex.Lock()
+    c.successor = s
+    c.mutex.Unlock()
+    if err := cmd.Start(); err != nil {
+        c.mutex.Lock()
+        c.successor = nil
+        c.mutex.Unlock()
+        s.handoffServer.Close()
+        return err
+    }
+    log.Printf("restarting: started successor (pid %d)", cmd.Process.Pid)
+    go func () {
+        err := cmd.Wait()
+        c.mutex.Lock()
+        handedOff := c.handedOff
+        if !handedOff {
+            c.successor = nil
+        }
+        c.mutex.Unlock()
+        if !handedOff {
+            log.Printf("restart failed: successor exited before taking over (%v)", err)
+            s.handoffServer.Close()
+        }
+    }()
+    return nil
+}
+
+func (s *successor) ServeHTTP(response http.ResponseWriter, request *http.Request) {
+    if request.URL.Path != restartHandoffPath {
+        // forwarded by the successor.
+        s.cache.ServeHTTP(response, request)
+        return
+    }
+    if request.URL.Query().Get("token") != s.token {
+        response.WriteHeader(404)
+        fmt.Fprint(response, "404 not found")
+        return
+    }
+    if !s.handOff(response) {
+        return
+    }
+    // everything's been handed off.  give the requests still being served a
+    // chance to finish, then exit.
+    go func () {
+        <-s.shutDown
+        ctx, cancel := context.WithTimeout(context.Background(), shutdownRequestLimit)
+        s.handoffServer.Shutdown(ctx)
+        cancel()
+        log.Print("restart finished; exiting")
+        os.Exit(0)
+    }()
+}
+
+// returns once every unfinished archive has been released to the successor.
+func (s *successor) handOff(response http.ResponseWriter) bool {
+    c := s.cache
+    // from here on, requests for new archives are sent to the successor (see
+    // ServeHTTP), so the set of unfinished archives can only shrink.
+    c.mutex.Lock()
+    if c.handedOff {
+        c.mutex.Unlock()
+        response.WriteHeader(409)
+        return false
+    }
+    c.handedOff = true
+    archivesByURL := make(map[string]*archive, len(c.archivesByURL))
+    for u, ar := range c.archivesByURL {
+        archivesByURL[u] = ar
+    }
+    c.mutex.Unlock()
+
+    var first restartHandoffMessage
+    unfinished := map[string]*archive{}
+    finishedURLs := map[*archive]string{}
+    for u, ar := range archivesByURL {
+        ar.mutex.Lock()
+        state := ar.state
+        ar.mutex.Unlock()
+        if state == archiveStateFinished {
+            finishedURLs[ar] = u
+            first.Finished = append(first.Finished, restartHandoffArchive{ URL: u, Path: ar.path })
+        } else if state != archiveStateFailed {
+            unfinished[u] = ar
+            first.Archives = append(first.Archives, restartHandoffArchive{ URL: u, Path: ar.path })
+        }
+    }
+    for _, page := range c.hotPages.snapshot() {
+        if u, ok := finishedURLs[page.archive]; ok {
+            first.HotPages = append(first.HotPages, restartHandoffPage{ page.key, u, page.body, page.gzipped })
+        }
+    }
+
+    // stop accepting connections.  the successor has the socket now.
+    go func () {
+        ctx, cancel := context.WithTimeout(context.Background(), shutdownRequestLimit)
+        s.server.Shutdown(ctx)
+        cancel()
+        close(s.shutDown)
+    }()
+
+    response.Header().Set("Content-Type", "application/json")
+    encoder := json.NewEncoder(response)
+    flusher, _ := response.(http.Flusher)
+    send := func (m restartHandoffMessage) {
+        if err := encoder.Encode(m); err != nil {
+            log.Print("error sending restart handoff: ", err)
+        }
+        if flusher != nil {
+            flusher.Flush()
+        }
+    }
+    send(first)
+    log.Printf("handed off to successor; finishing %d archives", len(unfinished))
+
+    deadline := time.Now().Add(restartDrainLimit)
+    for len(unfinished) > 0 && time.Now().Before(deadline) {
+        time.Sleep(restartPollInterval)
+        for u, ar := range unfinished {
+            ar.mutex.Lock()
+            state := ar.state
+            ar.mutex.Unlock()
+            if state == archiveStateFinished || state == archiveStateFailed {
+                delete(unfinished, u)
+                send(restartHandoffMessage{ Released: &restartHandoffArchive{ URL: u, Path: ar.path } })
+            }
+        }
+    }
+    for u, ar := range unfinished {
+        log.Printf("giving up on %s after %v", u, restartDrainLimit)
+        if err := c.reclaim(u); err != nil {
+            log.Print(err)
+        }
+        send(restartHandoffMessage{ Released: &restartHandoffArchive{ URL: u, Path: ar.path } })
+    }
+    return true
+}
+
+// -- successor side
+
+// if this process was started by a restart, takes over from the predecessor.
+// returns once requests can be served.
+func (c *cache) takeOverFromPredecessor() error {
+    handoffURL := os.Getenv(predecessorEnv)
+    if handoffURL == "" {
+        return nil
+    }
+    target, err := url.Parse(handoffURL)
+    if err != nil {
+        return fmt.Errorf("%s: %v", predecessorEnv, err)
+    }
+    res, err := http.Get(handoffURL)
+    if err != nil {
+        return fmt.Errorf("couldn't reach the process being restarted: %v", err)
+    }
+    if res.StatusCode != 200 {
+        res.Body.Close()
+        return fmt.Errorf("%s from the process being restarted", res.Status)
+    }
+    decoder := json.NewDecoder(res.Body)
+    var first restartHandoffMessage
+    if err := decoder.Decode(&first); err != nil {
+        res.Body.Close()
+        return fmt.Errorf("couldn't read restart handoff: %v", err)
+    }
+
+    c.reconcileWithPredecessor(first.Finished)
+
+    proxy := httputil.NewSingleHostReverseProxy(&url.URL{ Scheme: target.Scheme, Host: target.Host })
+    director := proxy.Director
+    proxy.Director = func (request *http.Request) {
+        director(request)
+        // keep the predecessor from forwarding the request to another node.
+        if c.peers != nil {
+            request.Header.Set(peerForwardedHeader, c.peers.forwardedBy("successor"))
+        }
+    }
+    proxy.ErrorHandler = func (response http.ResponseWriter, request *http.Request, err error) {
+        log.Print("couldn't reach the process being restarted: ", err)
+        response.WriteHeader(503)
+        fmt.Fprint(response, "503 dezip is restarting; try again in a moment")
+    }
+    c.mutex.Lock()
+    c.predecessorProxy = proxy
+    c.predecessorArchives = map[string]string{}
+    for _, a := range first.Archives {
+        c.predecessorArchives[a.URL] = a.Path
+    }
+    c.mutex.Unlock()
+
+    warmed := 0
+    for _, p := range first.HotPages {
+        c.mutex.RLock()
+        ar := c.archivesByURL[p.ArchiveURL]
+        c.mutex.RUnlock()
+        if ar != nil && c.hotPages.warm(&hotPage{ key: p.Key, archive: ar, body: p.Body, gzipped: p.Gzipped }) {
+            warmed++
+        }
+    }
+    log.Printf("took over from the process being restarted (%d hot pages); it's finishing %d archives", warmed, len(first.Archives))
+
+    go func () {
+        defer res.Body.Close()
+        for {
+            var m restartHandoffMessage
+            if err := decoder.Decode(&m); err != nil {
+                if err != io.EOF {
+                    log.Print("restart handoff ended early: ", err)
+                }
+                break
+            }
+            if m.Released != nil {
+                c.adoptArchive(m.Released.URL, m.Released.Path)
+            }
+        }
+        // the predecessor is gone.  anything it didn't release was left
+        // unfinished.
+        c.mutex.RLock()
+        remaining := make(map[string]string, len(c.predecessorArchives))
+        for u, p := range c.predecessorArchives {
+            remaining[u] = p
+        }
+        c.mutex.RUnlock()
+        for u, p := range remaining {
+            c.adoptArchive(u, p)
+        }
+        c.mutex.Lock()
+        c.predecessorArchives = nil
+        c.mutex.Unlock()
+        log.Print("the process being restarted has exited")
+    }()
+    return nil
+}
+
+// the cache was loaded from the meta directory before the handoff, and the
+// predecessor may have finished or reclaimed archives in between.  makes the
+// cache's archives match the ones the predecessor had finished when it
+// handed off: missing ones are adopted, and ones it no longer had (or has
+// under another path) are dropped.  their files are the predecessor's to
+// remove.
+func (c *cache) reconcileWithPredecessor(finished []restartHandoffArchive) {
+    missing := make(map[string]string, len(finished))
+    for _, a := range finished {
+        missing[a.URL] = a.Path
+    }
+    var gone []*archive
+    c.mutex.Lock()
+    for u, ar := range c.archivesByURL {
+        if p, ok := missing[u]; ok && p == ar.path {
+            delete(missing, u)
+        } else {
+            delete(c.archivesByURL, u)
+            gone = append(gone, ar)
+        }
+    }
+    if len(gone) > 0 {
+        urls := c.archiveURLsToReclaim[:0]
+        for _, u := range c.archiveURLsToReclaim {
+            if c.archivesByURL[u] != nil {
+                urls = append(urls, u)
+            }
+        }
+        c.archiveURLsToReclaim = urls
+    }
+    c.mutex.Unlock()
+    for _, ar := range gone {
+        if ar.searchIndex != nil {
+            ar.searchIndex.close()
+        }
+    }
+    for u, p := range missing {
+        c.adoptArchive(u, p)
+    }
+    if len(gone) > 0 || len(missing) > 0 {
+        log.Printf("the process being restarted finished %d archives and reclaimed %d since the cache was loaded", len(missing), len(gone))
+    }
+}
+
+// returns the proxy to the predecessor if it's still working on archiveURL.
+func (c *cache) predecessorFor(archiveURL string) *httputil.ReverseProxy {
+    c.mutex.RLock()
+    defer c.mutex.RUnlock()
+    if _, ok := c.predecessorArchives[archiveURL]; !ok {
+        return nil
+    }
+    return c.predecessorProxy
+}
+
+// takes over an archive the predecessor is done with.  if it finished, it's
+// loaded like the archives in the cache at startup; otherwise, its files are
+// removed.
+func (c *cache) adoptArchive(archiveURL string, archivePath string) {
+    metadataPath := c.archiveMetadataPath(archivePath)
+    var ar *archive
+    file, err := os.Open(metadataPath)
+    if err == nil {
+        _, ar, err = archiveFromMetadata(file, metadataPath)
+        file.Close()
+    }
+    if err != nil {
+        // requests for the archive are still forwarded, so nothing here is
+        // using these files.
+        c.reclaimFiles(archivePath)
+        ar = nil
+    }
+    c.mutex.Lock()
+    delete(c.predecessorArchives, archiveURL)
+    if ar != nil && c.archivesByURL[archiveURL] == nil {
+        c.archivesByURL[archiveURL] = ar
+        c.archiveURLsToReclaim = append(c.archiveURLsToReclaim, archiveURL)
+    }
+    c.mutex.Unlock()
+}
@@ -75,6 +75,44 @@ window.addEventListener("load", function (event) {
         }
     }
 });
+// large result sets are split into pages.  load the next page in place when
+// the "more results" link is clicked.
+function bindMoreResults() {
+    let more = document.getElementById("more-results");
+    if (more === null)
+        return;
+    let link = more.getElementsByTagName("a")[0];
+    link.onclick = function (event) {
+        link.onclick = function () { return false; };
+        link.textContent = "loading\u2026";
+        let xhr = new XMLHttpRequest();
+        xhr.open("GET", link.href);
+        xhr.responseType = "document";
+        xhr.onload = function (e) {
+            if (xhr.status !== 200 || xhr.responseXML === null) {
+                location.href = link.href;
+                return;
+            }
+            let rows = xhr.responseXML.querySelectorAll("table.search-results > tbody > tr");
+            for (var i = 0; i < rows.length; ++i)
+                more.parentNode.insertBefore(document.importNode(rows[i], true), more);
+            more.parentNode.removeChild(more);
+            for (var i = 0; i < searchResults.length; ++i) {
+                var n = parseInt(searchResults[i].id, 10);
+                if (n > maximumFocus)
+                    maximumFocus = n;
+            }
+            bindMoreResults();
+        };
+        xhr.onerror = function (e) {
+            location.href = link.href;
+        };
+        xhr.send(null);
+        event.preventDefault();
+        return false;
+    };
+}
+bindMoreResults();
 window.addEventListener("keydown", function (event) {
     if (event.shiftKey || event.ctrlKey || event.altKey || event.metaKey)
         return true;
@@ -128,6 +166,300 @@ window.addEventListener("pageshow", function (event) {
         closeSearch(event);
 });
 
+// -- directory navigation
+
+// once a directory page is showing, other directories in the archive are
+// shown from the archive's manifest (see writeDirectoryManifest), which is
+// loaded on the first click.  moving around then only loads readmes.  if
+// anything is unexpected, the page is loaded from the server as usual.
+let manifest = null;
+let manifestFailed = false;
+let manifestPendingPath = null;
+let shownPath = location.pathname;
+const monthNames = ["january", "february", "march", "april", "may", "june",
+ "july", "august", "september", "october", "november", "december"];
+function escapeHTML(s) {
+    return s.replace(/&/g, "&amp;").replace(/</g, "&lt;").replace(/>/g, "&gt;")
+     .replace(/"/g, "&#34;").replace(/'/g, "&#39;");
+}
+// escapes a path the same way go's url.URL.EscapedPath() does.
+function escapePath(s) {
+    return encodeURIComponent(s)
+     .replace(/[!'()*]/g, function (c) { return "%" + c.charCodeAt(0).toString(16).toUpperCase(); })
+     .replace(/%(24|26|2B|2C|2F|3A|3B|3D|40)/g, function (e) { return decodeURIComponent(e); });
+}
+// the path of the archive itself, like /v1/6/https/example.org/a.zip/.
+function archiveBasePath(pathname) {
+    let components = pathname.split("/");
+    let length = parseInt(components[2], 10);
+    if (length !== length || length < 5 || length > components.length)
+        return null;
+    return components.slice(0, length).join("/") + "/";
+}
+function manifestDirectory(base, pathname) {
+    if (!pathname.startsWith(base) || !pathname.endsWith("/"))
+        return null;
+    let node = manifest.root;
+    let names = [];
+    let rest = pathname.slice(base.length, -1);
+    let components = rest === "" ? [] : rest.split("/");
+    for (var i = 0; i < components.length; ++i) {
+        let name;
+        try {
+            name = decodeURIComponent(components[i]);
+        } catch (e) {
+            return null;
+        }
+        let next = null;
+        for (var j = 0; j < node.c.length; ++j) {
+            if (node.c[j].n === name && node.c[j].c !== undefined) {
+                next = node.c[j];
+                break;
+            }
+        }
+        if (next === null)
+            return null;
+        node = next;
+        names.push(name);
+    }
+    return { node: node, names: names };
+}
+function countChildren(node) {
+    let counts = { files: 0, subdirectories: 0 };
+    for (var i = 0; i < node.c.length; ++i) {
+        if (node.c[i].c !== undefined)
+            counts.subdirectories++;
+        else
+            counts.files++;
+    }
+    return counts;
+}
+function formatDate(m) {
+    let parts = m.split("-");
+    let month = monthNames[parseInt(parts[1], 10) - 1];
+    return "<span class='abbr abbr-" + month + "'><span>" + month + "</span></span> " +
+     parseInt(parts[2], 10) + ", " + parts[0];
+}
+function formatSize(size) {
+    if (size >= 10000000)
+        return (size / 1000000).toFixed(0) + " MB";
+    else if (size >= 700000)
+        return (size / 1000000).toFixed(1) + " MB";
+    else if (size >= 10000)
+        return (size / 1000).toFixed(0) + " KB";
+    else if (size >= 700)
+        return (size / 1000).toFixed(1) + " KB";
+    return size + (size !== 1 ? " bytes" : " byte");
+}
+// the same rows writeDirectoryPage() writes, with an empty readme container.
+function directoryRowsHTML(dir) {
+    let node = dir.node;
+    let counts = countChildren(node);
+    let emptyCell = "<td class='light'>&mdash;</td>";
+    let h = "<tr class='back'><td>&nbsp;</td><td class='filename' colspan='4'>";
+    let parentLinkClass = counts.files > 0 && counts.subdirectories === 0 ? " class='adjust-for-dblborder'" : "";
+    if (dir.names.length > 0)
+        h += "<a href='..'" + parentLinkClass + ">..</a>";
+    else
+        h += "<a" + parentLinkClass + ">&nbsp;</a>";
+    h += "</td></tr>";
+    if (node.c.length === 0)
+        h += "<tr><td>&nbsp;</td><td colspan='4'><div class='empty'>empty directory</div></td></tr>";
+    let category = "directories";
+    for (var i = 0; i < node.c.length; ++i) {
+        let subdir = node.c[i];
+        if (subdir.c === undefined)
+            continue;
+        h += "<tr><td" + (category !== "" ? " class='category'>" + category : ">&nbsp;") + "</td>";
+        category = "";
+        let modified = subdir.m;
+        let prefix = "";
+        let subdirCounts = countChildren(subdir);
+        // collapse chains of single subdirectories, like the server does.
+        while (subdirCounts.subdirectories === 1 && subdirCounts.files === 0) {
+            prefix = prefix === "" ? subdir.n : prefix + "/" + subdir.n;
+            subdir = subdir.c[0];
+            subdirCounts = countChildren(subdir);
+        }
+        h += "<td class='filename'><a href='./";
+        if (prefix !== "") {
+            h += escapeHTML(escapePath(prefix)) + "/" + escapeHTML(escapePath(subdir.n)) +
+             "/'><span class='prefix'>" + escapeHTML(prefix) + "/</span>";
+        } else {
+            h += escapeHTML(escapePath(subdir.n)) + "/'>";
+        }
+        h += escapeHTML(subdir.n) + "</a></td>";
+        if (subdirCounts.files > 0)
+            h += "<td>" + subdirCounts.files + (subdirCounts.files !== 1 ? " files</td>" : " file</td>");
+        else
+            h += emptyCell;
+        if (subdirCounts.subdirectories === 1)
+            h += "<td>1 <span class='abbr abbr-subdirectory'><span>subdirectory</span></span></td>";
+        else if (subdirCounts.subdirectories > 1)
+            h += "<td>" + subdirCounts.subdirectories + " <span class='abbr abbr-subdirectories'><span>subdirectories</span></span></td>";
+        else
+            h += emptyCell;
+        h += "<td>" + formatDate(modified) + "</td></tr>";
+    }
+    category = "files";
+    for (var i = 0; i < node.c.length; ++i) {
+        let file = node.c[i];
+        if (file.c !== undefined)
+            continue;
+        if (category !== "")
+            h += "<tr class='dblborder'><td class='category'>files</td>";
+        else
+            h += "<tr><td>&nbsp;</td>";
+        category = "";
+        h += "<td class='filename'>";
+        if (file.k !== undefined)
+            h += "<div>";
+        h += "<a href='./" + escapeHTML(escapePath(file.n)) + "'>" + escapeHTML(file.n) + "</a>";
+        if (file.k !== undefined) {
+            h += " &#x2192; <a href='./" + escapeHTML(escapePath(file.k)) + "'>";
+            let slash = file.k.lastIndexOf("/");
+            if (slash >= 0 && slash + 1 < file.k.length)
+                h += "<span class='prefix'>" + escapeHTML(file.k.slice(0, slash + 1)) + "</span>" + escapeHTML(file.k.slice(slash + 1));
+            else
+                h += escapeHTML(file.k);
+            h += "</a></div>";
+        }
+        h += "</td>";
+        let lines = file.l === undefined ? 0 : file.l;
+        if (lines >= 0)
+            h += "<td>" + lines + (lines !== 1 ? " lines</td>" : " line</td>");
+        else
+            h += emptyCell;
+        h += "<td>" + formatSize(file.s === undefined ? 0 : file.s) + "</td><td>" + formatDate(file.m) + "</td></tr>";
+    }
+    if (node.r !== undefined) {
+        h += "<tr class='border'><td class='category' valign='top'>README</td>" +
+         "<td colspan='4' class='readme'><div class='readme-container' id='readme-container'></div></td></tr>";
+    }
+    return h;
+}
+// the same path header writeHeader() writes, up to the search button.
+function pathHeaderHTML(names) {
+    let depth = names.length;
+    let rootPath = "./" + "../".repeat(depth);
+    let shortName = manifest.url.slice(manifest.url.lastIndexOf("/") + 1);
+    let h = "";
+    if (depth === 0)
+        h += "<b>" + escapeHTML(manifest.url) + "</b>";
+    else
+        h += "<a href='" + rootPath + "'>" + escapeHTML(shortName) + "</a>";
+    for (var i = 0; i < names.length; ++i) {
+        if (i === names.length - 1)
+            h += " / <b>" + escapeHTML(names[i]) + "</b>";
+        else if (depth - i - 1 === 0)
+            h += " / <a href='.'>" + escapeHTML(names[i]) + "</a>";
+        else
+            h += " / <a href='" + "../".repeat(depth - i - 1) + "'>" + escapeHTML(names[i]) + "</a>";
+    }
+    return h + "  ";
+}
+// readmes are inserted from the body of the readme's own page.
+function loadReadme(container, href) {
+    let xhr = new XMLHttpRequest();
+    xhr.open("GET", href);
+    xhr.responseType = "document";
+    xhr.onload = function (e) {
+        if (xhr.status !== 200 || xhr.responseXML === null)
+            return;
+        let cell = xhr.responseXML.querySelector("table.file tr.fileborder > td:last-child");
+        if (cell === null)
+            return;
+        let nodes = cell.childNodes;
+        for (var i = 0; i < nodes.length; ++i)
+            container.appendChild(document.importNode(nodes[i], true));
+    };
+    xhr.send(null);
+}
+function showDirectory(pathname, push) {
+    let base = archiveBasePath(pathname);
+    let table = document.querySelector("table.directory");
+    let header = document.getElementById("path-header");
+    let searchButton = document.getElementById("open-search");
+    let dir = base === null ? null : manifestDirectory(base, pathname);
+    if (dir === null || table === null || header === null || searchButton === null) {
+        location.href = pathname;
+        return;
+    }
+    if (push)
+        history.pushState(null, "", pathname);
+    shownPath = pathname;
+    let names = dir.names;
+    let rootPath = "./" + "../".repeat(names.length);
+    let shortName = manifest.url.slice(manifest.url.lastIndexOf("/") + 1);
+    if (names.length > 0)
+        document.title = names[names.length - 1] + " in " + shortName + names.slice(0, -1).map(function (v) { return "/" + v; }).join("") + " - dezip.org";
+    else
+        document.title = shortName + " - dezip.org";
+    // replace everything between the logo and the search button.
+    while (header.firstChild.nextSibling !== searchButton)
+        header.removeChild(header.firstChild.nextSibling);
+    searchButton.insertAdjacentHTML("beforebegin", pathHeaderHTML(names));
+    searchButton.setAttribute("href", rootPath + "?search");
+    document.getElementById("search-form").setAttribute("action", rootPath);
+    table.tBodies[0].innerHTML = directoryRowsHTML(dir);
+    if (dir.node.r !== undefined)
+        loadReadme(document.getElementById("readme-container"), pathname + escapePath(dir.node.r));
+    window.scrollTo(0, 0);
+}
+function navigateToDirectory(pathname, push) {
+    if (manifest !== null) {
+        showDirectory(pathname, push);
+        return;
+    }
+    if (manifestFailed) {
+        location.href = pathname;
+        return;
+    }
+    let requested = manifestPendingPath !== null;
+    manifestPendingPath = pathname;
+    if (requested)
+        return;
+    let xhr = new XMLHttpRequest();
+    xhr.open("GET", archiveBasePath(location.pathname) + "?manifest");
+    xhr.responseType = "json";
+    xhr.onload = function (e) {
+        if (xhr.status === 200 && xhr.response !== null && xhr.response.root !== undefined)
+            manifest = xhr.response;
+        else
+            manifestFailed = true;
+        navigateToDirectory(manifestPendingPath, true);
+    };
+    xhr.onerror = function (e) {
+        manifestFailed = true;
+        location.href = manifestPendingPath;
+    };
+    xhr.send(null);
+}
+document.addEventListener("click", function (event) {
+    if (event.defaultPrevented || event.button !== 0 || event.shiftKey || event.ctrlKey || event.altKey || event.metaKey)
+        return;
+    if (document.querySelector("table.directory") === null || document.getElementById("progress-overlay") !== null)
+        return;
+    let link = event.target.closest("a");
+    if (link === null || !link.hasAttribute("href"))
+        return;
+    let url = new URL(link.href);
+    let base = archiveBasePath(location.pathname);
+    if (url.origin !== location.origin || url.search !== "" || url.hash !== "" ||
+     !url.pathname.endsWith("/") || base === null || archiveBasePath(url.pathname) !== base)
+        return;
+    event.preventDefault();
+    navigateToDirectory(url.pathname, true);
+});
+window.addEventListener("popstate", function (event) {
+    if (location.pathname === shownPath)
+        return;
+    if (manifest === null || document.querySelector("table.directory") === null)
+        location.reload();
+    else
+        showDirectory(location.pathname, false);
+});
+
 // -- progress bar
 
 if (document.getElementById("progress-overlay") !== null) {
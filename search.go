@@ -2,6 +2,7 @@ package main
 
 import (
     "bytes"
+    "encoding/binary"
     "fmt"
     "html"
     "io"
@@ -11,6 +12,9 @@ import (
     "path"
     "regexp"
     "runtime/debug"
+    "sort"
+    "strings"
+    "sync"
     "syscall"
     "time"
 )
@@ -28,15 +32,47 @@ const endSearchMarker = "<!-- END SEARCH -->"
 const matchContextLinesBefore = 2
 const matchContextLinesAfter = 2
 
+// searches stop after a file brings the number of matches on the page up to
+// this many.  the rest of the results are fetched on demand, starting from the
+// next candidate file.
+const searchResultsPerPage = 250
+
+// paths containing one of these directory names are searched after everything
+// else, since the results there are rarely the ones people are looking for.
+var vendoredDirectoryNames = map[string]bool{
+    "vendor": true,
+    "vendored": true,
+    "node_modules": true,
+    "bower_components": true,
+    "third_party": true,
+    "third-party": true,
+    "thirdparty": true,
+    "external": true,
+    "extern": true,
+    "deps": true,
+}
+
 type searchResult struct {
     file string
     firstLine int
     lines int
     html string
 
+    // set on the last result if the search stopped early.  this is where the
+    // next page of results should pick up.
+    next *searchPosition
+
     err error
 }
 
+type searchPosition struct {
+    // the index into the ranked list of candidate files.
+    candidate int
+    // the number of matches on previous pages, so anchor ids keep counting
+    // up from one page to the next.
+    match int
+}
+
 type searchLineType int
 const (
     lineTypeNoMatch searchLineType = iota
@@ -51,6 +87,86 @@ const (
 type searchResultLine struct {
     lineType searchLineType
     bytes []byte
+    // to show the line out of context: the tags reopening the elements it
+    // starts inside of, and the end tags for the elements open at its end.
+    begin []byte
+    end []byte
+}
+
+// rendered files keep highlighting elements open from one line to the next
+// (see highlightWriter), so lines shown out of context need the elements
+// they start inside of reopened, and the ones open at their end closed.
+// tagStack follows the open elements from line to line.
+type tagStack struct {
+    open [][]byte
+}
+
+// updates the stack past the tags in line.
+func (s *tagStack) scan(line []byte) {
+    for {
+        i := bytes.IndexByte(line, '<')
+        if i < 0 {
+            return
+        }
+        j := bytes.IndexByte(line[i:], '>')
+        if j < 0 {
+            return
+        }
+        tag := line[i:i+j+1]
+        line = line[i+j+1:]
+        if tag[1] != '/' {
+            s.open = append(s.open, tag)
+        } else if len(s.open) > 0 {
+            s.open = s.open[:len(s.open)-1]
+        }
+    }
+}
+
+// the tags reopening the open elements.  nil if there aren't any.
+func (s *tagStack) begin() []byte {
+    if len(s.open) == 0 {
+        return nil
+    }
+    return bytes.Join(s.open, nil)
+}
+
+// the end tags closing the open elements.  nil if there aren't any.
+func (s *tagStack) end() []byte {
+    var b []byte
+    for i := len(s.open) - 1; i >= 0; i-- {
+        name := s.open[i][1:len(s.open[i])-1]
+        if j := bytes.IndexByte(name, ' '); j >= 0 {
+            name = name[:j]
+        }
+        b = append(b, "</"...)
+        b = append(b, name...)
+        b = append(b, '>')
+    }
+    return b
+}
+
+// returns line with begin before it, and end before its newline.
+func wrapLine(begin []byte, line []byte, end []byte) []byte {
+    text := bytes.TrimSuffix(line, []byte("\n"))
+    wrapped := make([]byte, 0, len(begin) + len(line) + len(end))
+    wrapped = append(append(append(wrapped, begin...), text...), end...)
+    return append(wrapped, line[len(text):]...)
+}
+
+// joins lines into html which stands on its own.
+func joinResultLines(lines []searchResultLine) string {
+    var b bytes.Buffer
+    for i, line := range lines {
+        begin, end := line.begin, line.end
+        if i > 0 {
+            begin = nil
+        }
+        if i < len(lines) - 1 {
+            end = nil
+        }
+        b.Write(wrapLine(begin, line.bytes, end))
+    }
+    return b.String()
 }
 
 func matchLines(content []byte, query string, tags func()(string, string), visit func(searchResultLine)) {
@@ -61,7 +177,7 @@ func matchLines(content []byte, query string, tags func()(string, string), visit
     if start < 0 {
         // if the begin search marker doesn't appear in the file, then the
         // entire file is just surrounding text.
-        visit(searchResultLine{ lineTypeSurrounding, content })
+        visit(searchResultLine{ lineType: lineTypeSurrounding, bytes: content })
         return
     }
     before := buf[:start+len(beginSearchMarker)]
@@ -70,13 +186,13 @@ func matchLines(content []byte, query string, tags func()(string, string), visit
     if end < 0 {
         // this shouldn't happen, but treat the entire file as surrounding text
         // if it does.
-        visit(searchResultLine{ lineTypeSurrounding, content })
+        visit(searchResultLine{ lineType: lineTypeSurrounding, bytes: content })
         return
     }
     after := buf[end:]
     buf = buf[:end]
 
-    visit(searchResultLine{ lineTypeSurrounding, before })
+    visit(searchResultLine{ lineType: lineTypeSurrounding, bytes: before })
 
     // loop over the lines of the file, looking for the query
     // string.  this code makes a few assumptions about the file's
@@ -89,8 +205,9 @@ func matchLines(content []byte, query string, tags func()(string, string), visit
     // - all elements are formatting elements -- if a match spans multiple
     //   elements, the user agent will need to run the "adoption agency
     //   algorithm" in order for the result to look reasonable.
-    // - since results are written line-by-line, elements cannot span multiple
-    //   lines.
+    // - elements which span multiple lines are tracked with a tagStack, so
+    //   each line can be shown on its own.
+    var stack tagStack
     tagsRemoved := []byte{}
     offsets := []int{}
     escapedQuery := []byte(html.EscapeString(query))
@@ -124,10 +241,13 @@ func matchLines(content []byte, query string, tags func()(string, string), visit
         offsets = append(offsets, offset)
         line := buf[:i+offset]
         buf = buf[i+offset:]
+        var result searchResultLine
+        result.begin = stack.begin()
+        stack.scan(line)
+        result.end = stack.end()
         // search for the query string in the text with all tags removed.
         index := bytes.Index(tagsRemoved, escapedQuery)
         lastEnd := 0
-        var result searchResultLine
         for index >= 0 {
             // match!  find the original offsets and insert begin/end tags.
             result.lineType = lineTypeMatch
@@ -159,10 +279,10 @@ func matchLines(content []byte, query string, tags func()(string, string), visit
         }
         visit(result)
     }
-    visit(searchResultLine{ lineTypeSurrounding, after })
+    visit(searchResultLine{ lineType: lineTypeSurrounding, bytes: after })
 }
 
-func (c *cache) search(ar *archive, query string, filter string, results chan searchResult) {
+func (c *cache) search(ar *archive, query string, filter string, from searchPosition, results chan searchResult) {
     defer close(results)
     defer func () {
         if r := recover(); r != nil {
@@ -181,14 +301,16 @@ func (c *cache) search(ar *archive, query string, filter string, results chan se
     // startTime := time.Now()
     timeout := time.After(searchTimeoutSeconds * time.Second)
     searched := 0
-    globalMatch := 0
+    globalMatch := from.match
     filenames, err := ar.searchIndex.search([]byte(query))
     if err != nil {
         results <- searchResult{ err: fmt.Errorf("there's a problem with the search index: %s", err.Error()) }
         log.Print(err)
         return
     }
-    for _, filename := range filenames {
+    rankSearchCandidates(filenames, query)
+    for candidate := from.candidate; candidate < len(filenames); candidate++ {
+        filename := filenames[candidate]
         if globalMatch >= searchResultLimit {
             results <- searchResult{ err: fmt.Errorf("to avoid melting your browser, only the first %d matches have been returned.", searchResultLimit) }
             return
@@ -196,6 +318,10 @@ func (c *cache) search(ar *archive, query string, filter string, results chan se
         if filterRegexp != nil && !filterRegexp.MatchString(filename) {
             continue
         }
+        if globalMatch - from.match >= searchResultsPerPage {
+            results <- searchResult{ next: &searchPosition{ candidate, globalMatch } }
+            return
+        }
         ar.mutex.Lock()
         rendered := ar.requestRender(filename)
         ar.mutex.Unlock()
@@ -223,7 +349,7 @@ func (c *cache) search(ar *archive, query string, filter string, results chan se
             }
             matchLine := -1
             lineNumber := 1
-            var lines [][]byte
+            var lines []searchResultLine
             matchLines(buf, query, tags, func (line searchResultLine) {
                 if line.lineType == lineTypeSurrounding {
                     return
@@ -231,14 +357,14 @@ func (c *cache) search(ar *archive, query string, filter string, results chan se
                     matchLine = len(lines)
                 }
                 lineNumber++
-                lines = append(lines, line.bytes)
+                lines = append(lines, line)
                 if matchLine >= 0 && len(lines) > matchLine + matchContextLinesAfter + matchContextLinesBefore + 1 {
                     numLines := matchLine + matchContextLinesAfter + 1
                     results <- searchResult{
                         file: filename,
                         firstLine: lineNumber - len(lines),
                         lines: numLines,
-                        html: string(bytes.Join(lines[:numLines], nil)),
+                        html: joinResultLines(lines[:numLines]),
                     }
                     lines = lines[numLines:]
                     matchLine = -1
@@ -257,7 +383,7 @@ func (c *cache) search(ar *archive, query string, filter string, results chan se
                     file: filename,
                     firstLine: lineNumber - len(lines),
                     lines: numLines,
-                    html: string(bytes.Join(lines[:numLines], nil)),
+                    html: joinResultLines(lines[:numLines]),
                 }
             }
         }
@@ -265,6 +391,44 @@ func (c *cache) search(ar *archive, query string, filter string, results chan se
     // results <- searchResult{ err: fmt.Errorf("searched files: %d; elapsed time: %v", searched, time.Now().Sub(startTime)) }
 }
 
+// sort the candidate files so the most likely results are searched first:
+// files whose names contain the query, then files outside vendored
+// directories, then shallower paths.  otherwise the order of the archive is
+// kept.
+func rankSearchCandidates(filenames []string, query string) {
+    type rank struct {
+        nameMatches bool
+        vendored bool
+        depth int
+    }
+    lowerQuery := strings.ToLower(query)
+    ranks := make(map[string]rank, len(filenames))
+    for _, filename := range filenames {
+        components := strings.Split(filename, "/")
+        r := rank{
+            nameMatches: strings.Contains(strings.ToLower(components[len(components)-1]), lowerQuery),
+            depth: len(components),
+        }
+        for _, component := range components[:len(components)-1] {
+            if vendoredDirectoryNames[strings.ToLower(component)] {
+                r.vendored = true
+                break
+            }
+        }
+        ranks[filename] = r
+    }
+    sort.SliceStable(filenames, func (i, j int) bool {
+        a, b := ranks[filenames[i]], ranks[filenames[j]]
+        if a.nameMatches != b.nameMatches {
+            return a.nameMatches
+        }
+        if a.vendored != b.vendored {
+            return b.vendored
+        }
+        return a.depth < b.depth
+    })
+}
+
 func insertSearchAnchors(w io.Writer, r io.Reader, query string) error {
     var b bytes.Buffer
     _, err := b.ReadFrom(r)
@@ -319,16 +483,48 @@ func (rk *rabinKarp) next() bool {
 
 // -- search index
 
+// the index starts with a bloom filter of the trigrams in each file: one row
+// of bits for each hash value, with one bit per file in each row.  then the
+// length of each filename, then the filenames themselves.  a search ANDs
+// together the rows for the trigrams in the query, leaving the files which
+// might contain it.
 const filterBits = 14
 const filterSize = 1 << filterBits
 const filterMask = filterSize - 1
 const filterMix = 2166136261 // this is the fnv 32-bit offset basis
+
+// setting each trigram's bits straight into the file's rows would touch pages
+// all over the filter for every file.  instead, the filter is built in memory
+// a block of files at a time: a block has filterBlockWords words of each row,
+// so a file's bits all land in one block, and the block (1 MB) mostly stays in
+// cache while the file is indexed.  the blocks are transposed into rows once
+// every file has been added.  the blocks come out of the memory budget; if
+// there isn't enough available, bits are set straight into the mapped file
+// instead.
+const filterBlockWords = 8
+const filterBlockFiles = filterBlockWords * 64
+
+// the blocks are held while the archive's files are read and analyzed, which
+// wait for memory themselves.  so that those always have most of the budget
+// to make progress in, the blocks of every index being built can only take
+// 1/largeRenderFraction of it between them.
+var filterBlockMemory = newMemoryGate(memoryBudget / largeRenderFraction)
+
 type searchIndex struct {
     file *os.File
     contents []byte
     numberOfFiles int
 
     nextFileIndex int
+    // while the index is being built in memory.
+    blocks [][]uint64
+    filenameLengths []byte
+    reserved int64
+
+    // the index is closed when its archive fails, possibly while it's still
+    // being built, so building and closing hold this.
+    mutex sync.Mutex
+    closed bool
 }
 const PROT_READ = 0x1
 const PROT_WRITE = 0x2
@@ -340,18 +536,34 @@ func createSearchIndex(filename string, numberOfFiles int) (*searchIndex, error)
     if err != nil {
         return nil, err
     }
+    blocks := (numberOfFiles + filterBlockFiles - 1) / filterBlockFiles
+    size := int64(blocks) * filterSize * filterBlockWords * 8
+    if size <= filterBlockMemory.total {
+        if reserved, ok := filterBlockMemory.tryReserve(size); ok {
+            if _, ok := memory.tryReserve(reserved); ok {
+                idx.reserved = reserved
+                idx.blocks = make([][]uint64, blocks)
+                idx.filenameLengths = make([]byte, numberOfFiles)
+            } else {
+                filterBlockMemory.release(reserved)
+            }
+        }
+    }
+    // filenames are appended after the space for the filter.
     if err = idx.file.Truncate(int64(idx.filenamesOffset())); err != nil {
-        idx.file.Close()
+        idx.close()
         return nil, err
     }
     if _, err = idx.file.Seek(0, io.SeekEnd); err != nil {
-        idx.file.Close()
+        idx.close()
         return nil, err
     }
-    idx.contents, err = syscall.Mmap(int(idx.file.Fd()), 0, idx.filenamesOffset(), PROT_READ | PROT_WRITE, MAP_SHARED)
-    if err != nil {
-        idx.file.Close()
-        return nil, err
+    if idx.blocks == nil {
+        idx.contents, err = syscall.Mmap(int(idx.file.Fd()), 0, idx.filenamesOffset(), PROT_READ | PROT_WRITE, MAP_SHARED)
+        if err != nil {
+            idx.file.Close()
+            return nil, err
+        }
     }
     return idx, nil
 }
@@ -362,16 +574,38 @@ func openSearchIndex(filename string, numberOfFiles int) (*searchIndex, error) {
     if err != nil {
         return nil, err
     }
-    idx.contents, err = syscall.Mmap(int(idx.file.Fd()), 0, idx.filenamesOffset(), PROT_READ, MAP_SHARED)
-    if err != nil {
+    if err = idx.mmap(); err != nil {
         idx.file.Close()
         return nil, err
     }
     return idx, nil
 }
+func (idx *searchIndex) mmap() error {
+    var err error
+    idx.contents, err = syscall.Mmap(int(idx.file.Fd()), 0, idx.filenamesOffset(), PROT_READ, MAP_SHARED)
+    return err
+}
 func (idx *searchIndex) close() {
+    idx.mutex.Lock()
+    defer idx.mutex.Unlock()
+    if idx.closed {
+        return
+    }
+    idx.closed = true
     idx.file.Close()
-    syscall.Munmap(idx.contents)
+    if idx.contents != nil {
+        syscall.Munmap(idx.contents)
+        idx.contents = nil
+    }
+    idx.releaseBlocks()
+}
+// call with idx.mutex held.
+func (idx *searchIndex) releaseBlocks() {
+    idx.blocks = nil
+    idx.filenameLengths = nil
+    memory.release(idx.reserved)
+    filterBlockMemory.release(idx.reserved)
+    idx.reserved = 0
 }
 func (idx *searchIndex) filterStride() int {
     return (idx.numberOfFiles + 7) / 8
@@ -382,7 +616,7 @@ func (idx *searchIndex) filenamesOffset() int {
 func (idx *searchIndex) trigramFilter() []byte {
     return idx.contents[:idx.filterStride() * filterSize]
 }
-func (idx *searchIndex) filenameLengths() []byte {
+func (idx *searchIndex) filenameLengthsInFile() []byte {
     return idx.contents[idx.filterStride() * filterSize:idx.filenamesOffset()]
 }
 func (idx *searchIndex) addFile(name string, contents []byte) {
@@ -393,49 +627,165 @@ func (idx *searchIndex) addFile(name string, contents []byte) {
         log.Printf("searchIndex.addFile(): ignoring file '%.9s...' - name too long to index", name)
         return
     }
+    idx.mutex.Lock()
+    defer idx.mutex.Unlock()
+    if idx.closed {
+        return
+    }
     rk := newRabinKarp(contents, 3)
-    filter := idx.trigramFilter()
-    stride := idx.filterStride()
     index := idx.nextFileIndex
     idx.nextFileIndex++
+    if idx.blocks == nil {
+        filter := idx.trigramFilter()
+        stride := idx.filterStride()
+        for rk.next() {
+            h := rk.hash * filterMix
+            filter[stride * int(h & filterMask) + index / 8] |= 1 << (index % 8)
+            filter[stride * int((h >> filterBits) & filterMask) + index / 8] |= 1 << (index % 8)
+        }
+        idx.filenameLengthsInFile()[index] = byte(len(name))
+        io.WriteString(idx.file, name)
+        return
+    }
+    block := idx.blocks[index / filterBlockFiles]
+    if block == nil {
+        block = make([]uint64, filterSize * filterBlockWords)
+        idx.blocks[index / filterBlockFiles] = block
+    }
+    word := (index % filterBlockFiles) / 64
+    bit := uint64(1) << (index % 64)
     for rk.next() {
         h := rk.hash * filterMix
-        filter[stride * int(h & filterMask) + index / 8] |= 1 << (index % 8)
-        filter[stride * int((h >> filterBits) & filterMask) + index / 8] |= 1 << (index % 8)
+        block[int(h & filterMask) * filterBlockWords + word] |= bit
+        block[int((h >> filterBits) & filterMask) * filterBlockWords + word] |= bit
     }
-    idx.filenameLengths()[index] = byte(len(name))
+    idx.filenameLengths[index] = byte(len(name))
     io.WriteString(idx.file, name)
 }
+
+// writes the filter and filename lengths to the file once every file has
+// been added, and maps them for searching.
+func (idx *searchIndex) finish() error {
+    idx.mutex.Lock()
+    defer idx.mutex.Unlock()
+    if idx.closed {
+        return fmt.Errorf("the search index was closed before it was finished")
+    }
+    if idx.blocks == nil {
+        // the bits are already in the file, mapped writable.
+        syscall.Munmap(idx.contents)
+        idx.contents = nil
+        return idx.mmap()
+    }
+    stride := idx.filterStride()
+    // write a batch of rows at a time.
+    rowsPerWrite := 1 + (1 << 20) / (stride + 1)
+    rows := make([]byte, 0, rowsPerWrite * stride)
+    offset := int64(0)
+    for row := 0; row < filterSize; row++ {
+        start := len(rows)
+        rows = rows[:start + stride]
+        for b, block := range idx.blocks {
+            // each word holds 64 files, eight to a byte, in the same order
+            // as the row's bytes.
+            to := rows[start + b * filterBlockWords * 8:start + min((b + 1) * filterBlockWords * 8, stride)]
+            if block == nil {
+                for i := range to {
+                    to[i] = 0
+                }
+                continue
+            }
+            for w := 0; w < filterBlockWords && len(to) > 0; w++ {
+                var bytes [8]byte
+                binary.LittleEndian.PutUint64(bytes[:], block[row * filterBlockWords + w])
+                n := copy(to, bytes[:])
+                to = to[n:]
+            }
+        }
+        if len(rows) + stride > cap(rows) || row == filterSize - 1 {
+            if _, err := idx.file.WriteAt(rows, offset); err != nil {
+                return err
+            }
+            offset += int64(len(rows))
+            rows = rows[:0]
+        }
+    }
+    if _, err := idx.file.WriteAt(idx.filenameLengths, offset); err != nil {
+        return err
+    }
+    idx.releaseBlocks()
+    return idx.mmap()
+}
+
 func (idx *searchIndex) search(query []byte) ([]string, error) {
     rk := newRabinKarp(query, 3)
     filter := idx.trigramFilter()
     stride := idx.filterStride()
-    matches := bytes.Repeat([]byte{0xff}, stride)
-    filenames := []string{}
+    // each trigram has two rows, and repeated trigrams don't need to be
+    // checked again.
+    var rows []int
+    seen := map[int]bool{}
     for rk.next() {
         h := rk.hash * filterMix
-        for i := 0; i < stride; i++ {
-            matches[i] &= filter[stride * int(h & filterMask) + i]
-            matches[i] &= filter[stride * int((h >> filterBits) & filterMask) + i]
+        for _, row := range []int{ int(h & filterMask), int((h >> filterBits) & filterMask) } {
+            if !seen[row] {
+                seen[row] = true
+                rows = append(rows, row)
+            }
+        }
+    }
+    // AND the rows together a word at a time, stopping as soon as no files
+    // are left.
+    matches := make([]uint64, (stride + 7) / 8)
+    for i := range matches {
+        matches[i] = ^uint64(0)
+    }
+    filenames := []string{}
+    for _, row := range rows {
+        bits := filter[row * stride:(row + 1) * stride]
+        remaining := uint64(0)
+        i := 0
+        for ; i + 8 <= len(bits); i += 8 {
+            m := matches[i / 8] & binary.LittleEndian.Uint64(bits[i:])
+            matches[i / 8] = m
+            remaining |= m
+        }
+        if i < len(bits) {
+            var last [8]byte
+            copy(last[:], bits[i:])
+            m := matches[i / 8] & binary.LittleEndian.Uint64(last[:])
+            matches[i / 8] = m
+            remaining |= m
+        }
+        if remaining == 0 {
+            return filenames, nil
+        }
+    }
+    // read all the filenames at once rather than one read per match.
+    nameLengths := idx.filenameLengthsInFile()
+    namesLength := 0
+    for _, n := range nameLengths {
+        if n == 0 {
+            break
         }
+        namesLength += int(n)
     }
-    nameLengths := idx.filenameLengths()
-    nameOffset := int64(idx.filenamesOffset())
+    names := make([]byte, namesLength)
+    if m, err := idx.file.ReadAt(names, int64(idx.filenamesOffset())); m != namesLength {
+        return nil, err
+    }
+    nameOffset := 0
     for i := 0; i < idx.numberOfFiles; i++ {
         n := int(nameLengths[i])
         if n == 0 {
             break
         }
         offset := nameOffset
-        nameOffset += int64(n)
-        if matches[i / 8] & (1 << (i % 8)) == 0 {
+        nameOffset += n
+        if matches[i / 64] & (1 << (i % 64)) == 0 {
             continue
         }
-        buf := make([]byte, n)
-        if m, err := idx.file.ReadAt(buf, offset); n != m {
-            return nil, err
-        }
-        filenames = append(filenames, string(buf))
+        filenames = append(filenames, string(names[offset:offset + n]))
     }
     return filenames, nil
 }
@@ -0,0 +1,2062 @@
+// dispatch.c
+// generated by `dezip compile-grammars` for source.c, source.c++, source.js, source.ts, source.python, source.java, source.go, source.shell, text.html.basic, source.json.  do not edit.
+
+#include "tmlanguage.h"
+
+static const dispatch dispatch0 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000030, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000030, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000001e00000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x00000001ffffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch1 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000027fff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000008000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000010000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch2 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000080, // 20 ! " #
+    0x0000000000000004, 0x0000000000000001, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000001f40, 0x0000000000000000, 0x0000000000000010, 0x0000000000000010, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000002000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000010, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000008000, // X Y Z [
+    0x000000000000600e, 0x0000000000000000, 0x0000000000000004, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000011, // x y z {
+    0x0000000000000020, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch3 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000004000, 0x0000000000000008, 0x0000000000000000, // 20 ! " #
+    0x0000000000000bf8, 0x0000000000000000, 0x0000000000000000, 0x0000000000000004, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000006000, 0x0000000000004000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000006000, // < = > ?
+    0x0000000000004000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000002, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000001, 0x0000000000000000, 0x0000000000001000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch4 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000001, 0x0000000000000010, 0x0000000000000001, // 20 ! " #
+    0x00000000000017f0, 0x0000000000000001, 0x0000000000000000, 0x0000000000000008, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000002, // X Y Z [
+    0x0000000000000004, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000800, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch5 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000030, 0x0000000000000000, 0x0000000000000004, 0x0000000000000004, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000080, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000004, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000040, // X Y Z [
+    0x0000000000000783, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000004, // x y z {
+    0x0000000000000008, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch6 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000064, 0x0000000000000060, 0x0000000000000060, // 08 09 0a 0b
+    0x0000000000000060, 0x0000000000000060, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000064, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000010, 0x0000000000000000, 0x0000000000000400, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000007, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000060, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000008, 0x0000000000000180, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000200, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch7 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x00000000000000be, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000040, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch8 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000064, 0x0000000000000060, 0x0000000000000060, // 08 09 0a 0b
+    0x0000000000000060, 0x0000000000000060, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000064, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000010, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000007, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000060, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000008, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch9 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000004, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000004, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000007, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000008, 0x0000000000000030, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch10 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000020, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000020, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000001, 0x0000000000000038, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000006, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch11 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000020, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000020, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000001, 0x0000000000000038, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000006, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch12 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000004, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000004, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000007, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000018, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch13 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000004, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000004, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000007, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000008, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch14 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x000000000000000f, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch15 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x000000000000000f, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch16 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x000000000000000c, 0x0000000000000008, 0x0000000000000008, // 08 09 0a 0b
+    0x0000000000000008, 0x0000000000000008, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x000000000000000c, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000007, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000008, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch17 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000004, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000004, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000007, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000008, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch18 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000003, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x000000000000000c, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch19 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000001, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000006, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch20 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000004, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000003, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch21 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000005, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000002, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch22 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000007, 0x0000000000000007, 0x0000000000000007, // 08 09 0a 0b
+    0x0000000000000007, 0x0000000000000007, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000007, 0x0000000000000000, 0x0000000000000000, 0x0000000000000007, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch23 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000004, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000004, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000007, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch24 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000002, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000004, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch25 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000004, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000003, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch26 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000001, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000002, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch27 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000003, 0x0000000000000003, 0x0000000000000003, // 08 09 0a 0b
+    0x0000000000000003, 0x0000000000000003, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000003, 0x0000000000000000, 0x0000000000000000, 0x0000000000000003, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch28 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000002, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch29 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000002, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch30 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000003, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch31 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000002, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch32 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000002, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch33 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000002, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch34 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000003, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch35 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000002, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch36 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000003, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch37 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000002, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch38 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000003, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch39 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000002, 0x0000000000000002, 0x0000000000000002, // 08 09 0a 0b
+    0x0000000000000002, 0x0000000000000002, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000002, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch40 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch41 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch42 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch43 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch44 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch45 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000001, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch46 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch47 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch48 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch49 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000001, 0x0000000000000001, 0x0000000000000001, // 08 09 0a 0b
+    0x0000000000000001, 0x0000000000000001, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch50 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch51 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000bff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000400, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch52 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000007, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch53 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000001, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000002, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch54 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 08 09 0a 0b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 20 ! " #
+    0x0000000000000000, 0x0000000000000002, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+static const dispatch dispatch55 = {{
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 00 01 02 03
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 04 05 06 07
+    0x0000000000000000, 0x0000000000000001, 0x0000000000000001, 0x0000000000000001, // 08 09 0a 0b
+    0x0000000000000001, 0x0000000000000001, 0x0000000000000000, 0x0000000000000000, // 0c 0d 0e 0f
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 10 11 12 13
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 14 15 16 17
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 18 19 1a 1b
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 1c 1d 1e 1f
+    0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001, // 20 ! " #
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // $ % & '
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ( ) * +
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // , - . /
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 0 1 2 3
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 4 5 6 7
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // 8 9 : ;
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // < = > ?
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // @ A B C
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // D E F G
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // H I J K
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // L M N O
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // P Q R S
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // T U V W
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // X Y Z [
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // \ ] ^ _
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // ` a b c
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // d e f g
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // h i j k
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // l m n o
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // p q r s
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // t u v w
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // x y z {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, // | } ~ 7f
+}};
+
+// sorted by key.
+static const struct {
+    uint64_t key;
+    const dispatch *table;
+} compiledDispatches[] = {
+    { 0x027d83900dd56dfeULL, &dispatch8 }, // source.ts, 7 patterns
+    { 0x03b97a5058a77815ULL, &dispatch28 }, // source.ts, 2 patterns
+    { 0x049562f8e0fc1bc7ULL, &dispatch20 }, // source.js, 3 patterns
+    { 0x07c92e07b491edf6ULL, &dispatch50 }, // source.python, 1 patterns
+    { 0x07cc9407b494d11fULL, &dispatch40 }, // source.go, 1 patterns
+    { 0x07d6c607b49d7a9aULL, &dispatch46 }, // source.js, 1 patterns
+    { 0x07ee0db25cdbaeabULL, &dispatch5 }, // source.ts, 11 patterns
+    { 0x08065a07b4c5e6d8ULL, &dispatch45 }, // text.html.basic, 1 patterns
+    { 0x0b44a13a75b2a49fULL, &dispatch23 }, // source.ts, 3 patterns
+    { 0x0e1cb89258af5450ULL, &dispatch31 }, // source.java, 2 patterns
+    { 0x1105c1f14b4957b7ULL, &dispatch54 }, // source.c, 2 patterns
+    { 0x13b5ca67e4551821ULL, &dispatch2 }, // source.python, 16 patterns
+    { 0x172e83af8209ab9aULL, &dispatch22 }, // source.c, 3 patterns
+    { 0x1d37c8f908c247b9ULL, &dispatch42 }, // text.html.basic, 1 patterns
+    { 0x232419f6acd38692ULL, &dispatch4 }, // source.shell, 13 patterns
+    { 0x2d48b8feb8f0a2f3ULL, &dispatch33 }, // source.java, 2 patterns
+    { 0x2fce043d9b9fd64eULL, &dispatch6 }, // source.ts, 11 patterns
+    { 0x30ef456c7df889b3ULL, &dispatch41 }, // source.ts, 1 patterns
+    { 0x38706fc00d3012c2ULL, &dispatch26 }, // source.python, 2 patterns
+    { 0x38816dc00d3e828fULL, &dispatch26 }, // source.python, 2 patterns
+    { 0x3a4a4f8f84591b82ULL, &dispatch0 }, // text.html.basic, 37 patterns
+    { 0x3e423d8bfbbe3cb5ULL, &dispatch25 }, // source.c, 3 patterns
+    { 0x419657aae0e82898ULL, &dispatch48 }, // source.js, 1 patterns
+    { 0x428e144ec4db7659ULL, &dispatch42 }, // source.ts, 1 patterns
+    { 0x45258e1e473335b1ULL, &dispatch10 }, // source.ts, 6 patterns
+    { 0x47b04fbd3a424f86ULL, &dispatch21 }, // text.html.basic, 3 patterns
+    { 0x482eb13cbf04a6c3ULL, &dispatch41 }, // source.java, 1 patterns
+    { 0x49e6fefbef3bb9e3ULL, &dispatch48 }, // source.python, 1 patterns
+    { 0x4a0fa88f1c154924ULL, &dispatch35 }, // source.ts, 2 patterns
+    { 0x4f5328a354a7c374ULL, &dispatch32 }, // source.python, 2 patterns
+    { 0x52d7bbc61b954cacULL, &dispatch41 }, // source.go, 1 patterns
+    { 0x5b6b149b2ee97ac8ULL, &dispatch16 }, // source.ts, 4 patterns
+    { 0x5f17bd764346ae8dULL, &dispatch18 }, // source.go, 4 patterns
+    { 0x62d3178e726dfbe2ULL, &dispatch44 }, // source.python, 1 patterns
+    { 0x65e22a3d60ccb80bULL, &dispatch49 }, // source.python, 1 patterns
+    { 0x671e69ff348217e0ULL, &dispatch39 }, // source.java, 2 patterns
+    { 0x76125a3455dbc14cULL, &dispatch12 }, // source.ts, 5 patterns
+    { 0x7c135585ae76e91eULL, &dispatch29 }, // source.ts, 2 patterns
+    { 0x838eb131288610e8ULL, &dispatch2 }, // source.python, 16 patterns
+    { 0x880dc194976b52f2ULL, &dispatch13 }, // source.ts, 4 patterns
+    { 0x8ae341de889450f7ULL, &dispatch14 }, // source.shell, 4 patterns
+    { 0x8c77f24238f975d1ULL, &dispatch11 }, // source.ts, 6 patterns
+    { 0x8ce09e4fa07ab597ULL, &dispatch42 }, // text.html.basic, 1 patterns
+    { 0x9027f862b26be8deULL, &dispatch30 }, // source.json, 2 patterns
+    { 0x920fcf73187db0a0ULL, &dispatch34 }, // source.ts, 2 patterns
+    { 0x961992845a5a309eULL, &dispatch24 }, // source.c, 3 patterns
+    { 0x96cee1d7cdc34d32ULL, &dispatch52 }, // text.html.basic, 3 patterns
+    { 0xa05bc62002856c27ULL, &dispatch30 }, // source.js, 2 patterns
+    { 0xa13efabe4ecc6545ULL, &dispatch14 }, // source.c++, 4 patterns
+    { 0xa29ca64a5329001bULL, &dispatch5 }, // source.js, 11 patterns
+    { 0xad5d5649c7930c32ULL, &dispatch37 }, // source.js, 2 patterns
+    { 0xad7804398cbe364aULL, &dispatch51 }, // source.ts, 12 patterns
+    { 0xb04fdeafbde4e9caULL, &dispatch55 }, // source.c, 1 patterns
+    { 0xb112361a085165bfULL, &dispatch42 }, // source.ts, 1 patterns
+    { 0xb13afe1a08740babULL, &dispatch44 }, // source.ts, 1 patterns
+    { 0xb1672c1a089994c0ULL, &dispatch47 }, // source.java, 1 patterns
+    { 0xb1d3ec1a08f5f9e0ULL, &dispatch43 }, // source.ts, 1 patterns
+    { 0xb2fd2c8319992cd9ULL, &dispatch3 }, // source.shell, 15 patterns
+    { 0xb3ce0da8453d17e8ULL, &dispatch41 }, // source.json, 1 patterns
+    { 0xb59078999523ba72ULL, &dispatch17 }, // source.ts, 4 patterns
+    { 0xb98be31d3acdc813ULL, &dispatch15 }, // text.html.basic, 4 patterns
+    { 0xbfd4871bfbf22309ULL, &dispatch36 }, // source.shell, 2 patterns
+    { 0xcd419c5de85e00e0ULL, &dispatch38 }, // source.ts, 2 patterns
+    { 0xd50f7ab2be9c680bULL, &dispatch30 }, // source.c, 2 patterns
+    { 0xd8bd54b783d61c5aULL, &dispatch30 }, // source.go, 2 patterns
+    { 0xda1bcec4934cce7dULL, &dispatch41 }, // source.c, 1 patterns
+    { 0xda618e5ff903da1dULL, &dispatch19 }, // source.python, 3 patterns
+    { 0xde4d326410da9adcULL, &dispatch53 }, // source.go, 2 patterns
+    { 0xeb4f5747b596a4d7ULL, &dispatch9 }, // source.ts, 6 patterns
+    { 0xeed42b17e7156579ULL, &dispatch46 }, // source.c, 1 patterns
+    { 0xefbc50afa462915cULL, &dispatch27 }, // source.c, 2 patterns
+    { 0xf771aabcacab6f20ULL, &dispatch41 }, // source.c, 1 patterns
+    { 0xfb677bb7eb54e6f8ULL, &dispatch42 }, // source.ts, 1 patterns
+    { 0xfc8aa5dcdf25effeULL, &dispatch1 }, // source.ts, 18 patterns
+    { 0xfebdca412751dd17ULL, &dispatch7 }, // source.shell, 8 patterns
+};
+
+const dispatch *compiledDispatch(uint64_t key)
+{
+    size_t lo = 0;
+    size_t hi = sizeof(compiledDispatches) / sizeof(compiledDispatches[0]);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (compiledDispatches[mid].key < key)
+            lo = mid + 1;
+        else if (compiledDispatches[mid].key > key)
+            hi = mid;
+        else
+            return compiledDispatches[mid].table;
+    }
+    return 0;
+}
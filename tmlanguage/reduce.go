@@ -0,0 +1,121 @@
+// reduce.go
+
+package tm
+
+import (
+    "strings"
+)
+
+// most of the cost of highlighting comes from grammars' deeper structure:
+// states for blocks, expressions, and declarations, each trying dozens of
+// patterns at every position, and capture states that highlight within
+// matches.  most of the color on a page comes from a few kinds of scopes,
+// though, which are usually recognized with flat patterns.
+//
+// ReduceLanguages derives grammars which only recognize comments, strings,
+// numbers and other constants, keywords, and storage types.  the reduced
+// grammars have a single top-level state.  matching a comment or string rule
+// enters one more state, which only recognizes flat matches like escapes.
+// rules for other constructs are dropped, but the rules inside them are
+// hoisted to the top level, so a keyword inside a function body is still
+// found.  captures keep their scopes, but not their patterns.  includes of
+// other languages are dropped.
+func ReduceLanguages(languages []*Language) []*Language {
+    reduced := make([]*Language, len(languages))
+    for i, lang := range languages {
+        r := &reducer{ lang: lang }
+        rootRepoFunc := func (s string) *Rule { return lang.Repository[s] }
+        reduced[i] = &Language{
+            ScopeName: lang.ScopeName,
+            FileTypes: lang.FileTypes,
+            FirstLineMatch: lang.FirstLineMatch,
+            Patterns: r.reduce(nil, lang.Patterns, rootRepoFunc, map[*Rule]bool{}, true),
+        }
+    }
+    return reduced
+}
+
+// whether a rule with this name (which may list several scopes, separated by
+// spaces) is worth keeping in a reduced grammar.
+func keptInReducedLanguage(name string) bool {
+    for _, scope := range strings.Fields(name) {
+        if strings.HasPrefix(scope, "keyword.operator.") {
+            continue
+        }
+        for _, prefix := range []string{ "comment.", "string.", "constant.", "keyword.", "storage." } {
+            if strings.HasPrefix(scope, prefix) {
+                return true
+            }
+        }
+    }
+    return false
+}
+
+type reducer struct {
+    lang *Language
+}
+
+// appends the reduced versions of rules to out.  seen holds the rules
+// already added to out, so each rule is added once, however many times it's
+// included.  begin rules are only kept at the top level.
+func (r *reducer) reduce(out []*Rule, rules []*Rule, repoFunc func(string)*Rule, seen map[*Rule]bool, topLevel bool) []*Rule {
+    for _, rule := range rules {
+        if rule.Disabled != 0 || seen[rule] {
+            continue
+        }
+        seen[rule] = true
+        ruleRepoFunc := repoFunc
+        if len(rule.Repository) > 0 {
+            ruleRepoFunc = func (s string) *Rule {
+                if found := rule.Repository[s]; found != nil {
+                    return found
+                }
+                return repoFunc(s)
+            }
+        }
+        if len(rule.Include) > 0 {
+            if rule.Include == "$self" || rule.Include == "$base" {
+                out = r.reduce(out, r.lang.Patterns, func (s string) *Rule { return r.lang.Repository[s] }, seen, topLevel)
+            } else if strings.HasPrefix(rule.Include, "#") {
+                if included := repoFunc(rule.Include[1:]); included != nil {
+                    out = r.reduce(out, []*Rule{ included }, repoFunc, seen, topLevel)
+                }
+            }
+        } else if len(rule.Match) > 0 {
+            captures := reduceCaptures(rule.Captures)
+            if keptInReducedLanguage(rule.Name) || len(captures) > 0 {
+                out = append(out, &Rule{ Name: rule.Name, Match: rule.Match, Captures: captures })
+            }
+        } else if len(rule.Begin) > 0 && topLevel && (keptInReducedLanguage(rule.Name) || keptInReducedLanguage(rule.ContentName)) {
+            out = append(out, &Rule{
+                Name: rule.Name,
+                ContentName: rule.ContentName,
+                Begin: rule.Begin,
+                End: rule.End,
+                While: rule.While,
+                Captures: reduceCaptures(rule.Captures),
+                BeginCaptures: reduceCaptures(rule.BeginCaptures),
+                EndCaptures: reduceCaptures(rule.EndCaptures),
+                WhileCaptures: reduceCaptures(rule.WhileCaptures),
+                ApplyEndPatternLast: rule.ApplyEndPatternLast,
+                Patterns: r.reduce(nil, rule.Patterns, ruleRepoFunc, map[*Rule]bool{}, false),
+            })
+        } else {
+            out = r.reduce(out, rule.Patterns, ruleRepoFunc, seen, topLevel)
+        }
+    }
+    return out
+}
+
+func reduceCaptures(captures map[string]Capture) map[string]Capture {
+    var reduced map[string]Capture
+    for k, v := range captures {
+        if keptInReducedLanguage(v.Name) {
+            if reduced == nil {
+                reduced = map[string]Capture{}
+            }
+            reduced[k] = Capture{ Name: v.Name }
+        }
+    }
+    return reduced
+}
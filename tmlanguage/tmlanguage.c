@@ -29,8 +29,190 @@ struct pattern {
     bool backreferencingPattern;
     unsigned char *text;
     size_t len;
+
+    // if every match starts with ^, \A, or \G, which of them it could be.
+    // ^ and \A only match at the start of a line, and \G at the start of
+    // the search.
+    enum { LINE_ANCHOR = 1, SEARCH_ANCHOR = 2 } anchors;
 };
 
+// to find anchored patterns, patterns are only looked at closely enough to
+// tell where each alternative starts.  anything unusual (like changing the x
+// option partway through) gives up, and the pattern is treated as unanchored.
+typedef struct anchorScan {
+    const unsigned char *re;
+    size_t len;
+    size_t i;
+    bool extended;
+    bool failed;
+    int anchors;
+} anchorScan;
+
+static bool alternativesAnchored(anchorScan *a);
+
+static void skipSpace(anchorScan *a)
+{
+    while (a->extended && a->i < a->len) {
+        unsigned char c = a->re[a->i];
+        if (c == '#') {
+            while (a->i < a->len && a->re[a->i] != '\n')
+                a->i++;
+        } else if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+            a->i++;
+        else
+            break;
+    }
+}
+
+// skips (?imx-imx) or (?imx-imx: and returns the number of bytes, or 0 if
+// there isn't one.  sets *x if it turns on the x option.
+static size_t optionGroupLength(anchorScan *a, size_t i, bool *x)
+{
+    if (i + 2 >= a->len || a->re[i] != '(' || a->re[i+1] != '?')
+        return 0;
+    bool off = false;
+    *x = false;
+    for (size_t j = i + 2; j < a->len; ++j) {
+        unsigned char c = a->re[j];
+        if (c == ')' || c == ':')
+            return j > i + 2 ? j + 1 - i : 0;
+        else if (c == '-')
+            off = true;
+        else if (c == 'x')
+            *x = !off;
+        else if (c != 'i' && c != 'm')
+            return 0;
+    }
+    return 0;
+}
+
+static void skipClass(anchorScan *a)
+{
+    a->i++;
+    if (a->i < a->len && a->re[a->i] == '^')
+        a->i++;
+    if (a->i < a->len && a->re[a->i] == ']')
+        a->i++;
+    while (a->i < a->len) {
+        unsigned char c = a->re[a->i];
+        if (c == '\\')
+            a->i += 2;
+        else if (c == '[')
+            skipClass(a);
+        else if (c == ']') {
+            a->i++;
+            return;
+        } else
+            a->i++;
+    }
+    a->failed = true;
+}
+
+// skips one character, escape, class, or group.
+static void skipAtom(anchorScan *a)
+{
+    unsigned char c = a->re[a->i];
+    if (c == '\\') {
+        a->i += 2;
+    } else if (c == '[') {
+        skipClass(a);
+    } else if (c == '(') {
+        if (a->i + 2 < a->len && a->re[a->i+1] == '?' && a->re[a->i+2] == '#') {
+            while (a->i < a->len && a->re[a->i] != ')')
+                a->i++;
+            a->i++;
+            return;
+        }
+        bool x;
+        size_t options = optionGroupLength(a, a->i, &x);
+        if (options && memchr(a->re + a->i, 'x', options)) {
+            a->failed = true;
+            return;
+        }
+        a->i++;
+        alternativesAnchored(a);
+        if (a->i >= a->len)
+            a->failed = true;
+        a->i++;
+    } else
+        a->i++;
+    skipSpace(a);
+}
+
+// whether the alternative starting at a->i starts with an anchor, or with a
+// group whose alternatives all do, without a quantifier that could skip it.
+static bool atomAnchored(anchorScan *a)
+{
+    anchorScan b = *a;
+    const unsigned char *re = a->re;
+    size_t i = a->i;
+    if (i < a->len && re[i] == '^') {
+        b.i = i + 1;
+        b.anchors |= LINE_ANCHOR;
+    } else if (i + 1 < a->len && re[i] == '\\' && (re[i+1] == 'A' || re[i+1] == 'G')) {
+        b.i = i + 2;
+        b.anchors |= re[i+1] == 'A' ? LINE_ANCHOR : SEARCH_ANCHOR;
+    } else if (i < a->len && re[i] == '(') {
+        size_t j = i + 1;
+        bool x;
+        size_t options = optionGroupLength(a, i, &x);
+        if (options && re[i + options - 1] == ':' && !memchr(re + i, 'x', options))
+            j = i + options;
+        else if (j + 1 < a->len && re[j] == '?' && (re[j+1] == ':' || re[j+1] == '>'))
+            j += 2;
+        else if (j + 2 < a->len && re[j] == '?' && re[j+1] == '<' &&
+         re[j+2] != '=' && re[j+2] != '!') {
+            // a named group.
+            while (j < a->len && re[j] != '>')
+                j++;
+            j++;
+        } else if (j < a->len && re[j] == '?')
+            return false;
+        b.i = j;
+        if (!alternativesAnchored(&b) || b.failed || b.i >= a->len)
+            return false;
+        b.i++;
+    } else
+        return false;
+    skipSpace(&b);
+    a->anchors |= b.anchors;
+    return b.i >= a->len || !strchr("?*+{", re[b.i]);
+}
+
+// checks the alternatives up to the end of the current group, leaving a->i at
+// its closing paren (or the end of the pattern).
+static bool alternativesAnchored(anchorScan *a)
+{
+    bool anchored = true;
+    while (!a->failed) {
+        skipSpace(a);
+        anchored = anchored && atomAnchored(a);
+        while (!a->failed && a->i < a->len && a->re[a->i] != '|' &&
+         a->re[a->i] != ')')
+            skipAtom(a);
+        if (a->i >= a->len || a->re[a->i] == ')')
+            break;
+        a->i++;
+    }
+    return anchored && !a->failed;
+}
+
+// returns the anchors every match of the pattern starts with, or 0 if it
+// isn't anchored.
+static int startingAnchors(const unsigned char *regex, size_t len)
+{
+    anchorScan a = { .re = regex, .len = len };
+    // options at the very beginning apply to the whole pattern.
+    bool x;
+    for (size_t n; (n = optionGroupLength(&a, a.i, &x)) && regex[a.i + n - 1] == ')'; a.i += n) {
+        if (memchr(regex + a.i, 'x', n))
+            a.extended = x;
+    }
+    if (!alternativesAnchored(&a) || a.i < len)
+        return 0;
+    return a.anchors;
+}
+
 pattern *createPattern(const unsigned char *regex, size_t len,
  char **error)
 {
@@ -58,6 +240,7 @@ pattern *createPattern(const unsigned char *regex, size_t len,
         return 0;
     }
     p->captures = onig_number_of_captures(p->re) + 1;
+    p->anchors = startingAnchors(regex, len);
 #ifdef LOG
     fprintf(stderr, "[created '%.*s' %p (%p) - %d captures]\n", len, regex, p->re, p, p->captures);
 #endif
@@ -168,16 +351,71 @@ typedef struct patternInState {
     state *to; // for begin patterns
 } patternInState;
 
+// anchored patterns can only match at the start of a line or of the search,
+// so states with anchored patterns also keep a regset without them, for
+// searches which don't start at one of those positions (most of them, after
+// the first in each line).
 struct state {
     OnigRegSet *regset;
+    const dispatch *dispatch;
     pattern *whilePattern;
     pattern *endPattern;
     bool applyEndPatternLast;
     patternInState *patterns;
     size_t patternsCapacity;
     size_t patternsLength;
+
+    // null until the first anchored pattern is added, since until then it
+    // would be the same as regset.
+    OnigRegSet *floating;
+    // the index in patterns of each regex in floating.
+    int *floatingPatterns;
+    // the anchored patterns among the first 64, for dispatch tables.
+    uint64_t anchoredMask;
+    // the anchors the anchored patterns start with.
+    int anchors;
 };
 
+static void freeRegSet(OnigRegSet *set)
+{
+    if (!set)
+        return;
+    // take the regexes out here so they aren't freed by onig_regset_free.
+    // replacing a regex with null removes it and shifts the rest down, so go
+    // from the end.
+    for (int i = onig_regset_number_of_regex(set) - 1; i >= 0; --i)
+        onig_regset_replace(set, i, 0);
+    onig_regset_free(set);
+}
+
+static bool addFloatingPattern(state *s, pattern *p, int i)
+{
+    int res = onig_regset_add(s->floating, p->re);
+    if (res != ONIG_NORMAL) {
+        fprintf(stderr, "fail: onig_regset_add()\n");
+        return false;
+    }
+    s->floatingPatterns[onig_regset_number_of_regex(s->floating) - 1] = i;
+    return true;
+}
+
+// starts keeping the unanchored patterns in their own regset.
+static bool separateFloatingPatterns(state *s)
+{
+    int res = onig_regset_new(&s->floating, 0, 0);
+    for (size_t i = 0; res == ONIG_NORMAL && i < s->patternsLength; ++i) {
+        if (!addFloatingPattern(s, s->patterns[i].p, (int)i))
+            res = ONIGERR_MEMORY;
+    }
+    if (res != ONIG_NORMAL) {
+        fprintf(stderr, "out of memory in separateFloatingPatterns()\n");
+        freeRegSet(s->floating);
+        s->floating = 0;
+        return false;
+    }
+    return true;
+}
+
 static void addPatternInState(state *s, patternInState p)
 {
     if (!s)
@@ -193,13 +431,23 @@ static void addPatternInState(state *s, patternInState p)
             return;
         }
         s->patterns = realloc(s->patterns, cap * sizeof(patternInState));
+        s->floatingPatterns = realloc(s->floatingPatterns, cap * sizeof(int));
         s->patternsCapacity = cap;
     }
+    if (p.p->anchors && !s->floating && !separateFloatingPatterns(s))
+        return;
     int res = onig_regset_add(s->regset, p.p->re);
     if (res != ONIG_NORMAL) {
         fprintf(stderr, "fail: onig_regset_add()\n");
         return;
     }
+    int i = (int)s->patternsLength;
+    if (p.p->anchors) {
+        if (i < 64)
+            s->anchoredMask |= (uint64_t)1 << i;
+        s->anchors |= p.p->anchors;
+    } else if (s->floating)
+        addFloatingPattern(s, p.p, i);
     s->patterns[s->patternsLength++] = p;
     assert(s->patternsLength == onig_regset_number_of_regex(s->regset));
 }
@@ -239,16 +487,20 @@ void setWhile(state *s, pattern *while_)
     s->whilePattern = while_;
 }
 
+void setDispatch(state *s, const dispatch *d)
+{
+    if (d && s->patternsLength <= 64)
+        s->dispatch = d;
+}
+
 void freeState(state *s)
 {
     if (!s)
         return;
-    for (int i = 0; i < onig_regset_number_of_regex(s->regset); ++i) {
-        // zero out the regexes here so they aren't freed by onig_regset_free.
-        onig_regset_replace(s->regset, i, 0);
-    }
-    onig_regset_free(s->regset);
+    freeRegSet(s->regset);
+    freeRegSet(s->floating);
     free(s->patterns);
+    free(s->floatingPatterns);
     free(s);
 }
 
@@ -430,6 +682,81 @@ fail:
     return -1;
 }
 
+// whether one of s's anchored patterns could match at p: ^ matches at the
+// start of a line (but not after a newline at the very end), \A at the start
+// of the string, and \G where the search started.
+static bool atAnchor(state *s, const UChar *str, const UChar *strEnd,
+ const UChar *start, const UChar *p, OnigOptionType options)
+{
+    if ((s->anchors & SEARCH_ANCHOR) && p == start &&
+     !(options & ONIG_OPTION_NOT_BEGIN_POSITION))
+        return true;
+    return (s->anchors & LINE_ANCHOR) &&
+     (p == str || (p < strEnd && p[-1] == '\n'));
+}
+
+// finds the first position in [start, range] where one of s's patterns
+// matches, and returns the first of them that matches there, like
+// onig_regset_search() with ONIG_REGSET_POSITION_LEAD.  *region is set to the
+// match's region.
+static int searchState(state *s, const UChar *str, const UChar *strEnd,
+ const UChar *start, const UChar *range, OnigOptionType options,
+ int *matchpos, OnigRegion **region)
+{
+    if (s->dispatch && start < range) {
+        const UChar *p = start;
+        for (; p <= range && p < strEnd && *p < 0x80; ++p) {
+            uint64_t candidates = s->dispatch->candidates[*p];
+            if (!atAnchor(s, str, strEnd, start, p, options))
+                candidates &= ~s->anchoredMask;
+            // \G only matches where the search started.
+            OnigOptionType o = p == start ? options :
+             options | ONIG_OPTION_NOT_BEGIN_POSITION;
+            while (candidates) {
+                int i = __builtin_ctzll(candidates);
+                candidates &= candidates - 1;
+                *region = onig_regset_get_region(s->regset, i);
+                int res = onig_match(onig_regset_get_regex(s->regset, i), str,
+                 strEnd, p, *region, o);
+                if (res >= 0) {
+                    *matchpos = (int)(p - str);
+                    return i;
+                } else if (res != ONIG_MISMATCH)
+                    return res;
+            }
+        }
+        if (p > range)
+            return ONIG_MISMATCH;
+        // oniguruma steps over whole characters, so let it take over from
+        // the first non-ascii byte (or the end of the string).
+        if (p > start)
+            options |= ONIG_OPTION_NOT_BEGIN_POSITION;
+        start = p;
+    }
+    // the anchored patterns only need to be searched if the search covers a
+    // position where they can match.  (then they're searched along with the
+    // rest up to range, as usual, since oniguruma only finds literals which
+    // end before range.)
+    OnigRegSet *set = s->regset;
+    if (s->floating) {
+        const UChar *p = start;
+        while (p && p <= range && !atAnchor(s, str, strEnd, start, p, options)) {
+            // the next line start.
+            p = memchr(p, '\n', strEnd - p);
+            if (p)
+                p++;
+        }
+        if (!p || p > range)
+            set = s->floating;
+    }
+    int res = onig_regset_search(set, str, strEnd, start, range,
+     ONIG_REGSET_POSITION_LEAD, options, matchpos);
+    if (res < 0)
+        return res;
+    *region = onig_regset_get_region(set, res);
+    return set == s->floating ? s->floatingPatterns[res] : res;
+}
+
 static void renderCaptures(renderer *r, line *line, pattern *p,
  OnigRegion *region);
 
@@ -477,10 +804,10 @@ static void renderLine(renderer *r, line *line, size_t begin, size_t end,
              r->bytes + offset, r->bytes + end, endWhileRegion, options);
         }
         int matchpos;
-        int res = onig_regset_search(a.s->regset,
-         r->bytes + line->begin, r->bytes + line->endIncludingNewline,
-         r->bytes + offset, r->bytes + end,
-         ONIG_REGSET_POSITION_LEAD, options, &matchpos);
+        OnigRegion *region;
+        int res = searchState(a.s, r->bytes + line->begin,
+         r->bytes + line->endIncludingNewline, r->bytes + offset,
+         r->bytes + end, options, &matchpos, &region);
         if (res >= 0 && (endres < 0 || matchpos < endWhileRegion->beg[0] ||
          (a.s->applyEndPatternLast && matchpos == endWhileRegion->beg[0]))) {
 #ifdef LOG
@@ -488,7 +815,6 @@ static void renderLine(renderer *r, line *line, size_t begin, size_t end,
             for (int i = 0; i < onig_regset_number_of_regex(a.s->regset); ++i)
                 fprintf(stderr, "%d %p\n", i, onig_regset_get_regex(a.s->regset, i));
 #endif
-            OnigRegion *region = onig_regset_get_region(a.s->regset, res);
             patternInState p = a.s->patterns[res];
             renderCaptures(r, line, p.p, region);
 
@@ -12,9 +12,13 @@ import "C"
 import (
     "errors"
     "fmt"
+    "hash/fnv"
     "path"
     "runtime"
+    "sort"
     "strings"
+    "sync"
+    "sync/atomic"
     "unsafe"
 )
 
@@ -72,6 +76,12 @@ type Highlighter struct {
     ruleState map[*Rule]*C.state
     ruleRepository map[*Rule]func(string)*Rule
     deferredStates map[*Language][]deferredState
+    // the match and begin rules in each state, in order, for looking up its
+    // compiled dispatch table.
+    stateRules map[*C.state][]*Rule
+
+    // only used by DescribeStates().
+    stateDescriptions map[*C.state]*StateDescription
 }
 
 type deferredState struct {
@@ -80,6 +90,10 @@ type deferredState struct {
 }
 
 func NewHighlighter(languages []*Language, scopeData func(string)interface{}) (*Highlighter, error) {
+    return newHighlighter(languages, scopeData, false)
+}
+
+func newHighlighter(languages []*Language, scopeData func(string)interface{}, describeStates bool) (*Highlighter, error) {
     C.initialize()
     h := &Highlighter{
         languages: languages,
@@ -98,8 +112,13 @@ func NewHighlighter(languages []*Language, scopeData func(string)interface{}) (*
         ruleState: map[*Rule]*C.state{},
         ruleRepository: map[*Rule]func(string)*Rule{},
         deferredStates: map[*Language][]deferredState{},
+        stateRules: map[*C.state][]*Rule{},
+    }
+    if describeStates {
+        h.stateDescriptions = map[*C.state]*StateDescription{}
     }
     runtime.SetFinalizer(h, freeHighlighterData)
+    var jobs []*patternJob
     for _, lang := range languages {
         if _, ok := h.languagesByScopeName[lang.ScopeName]; ok {
             return nil, fmt.Errorf("tm.NewHighlighter(): two languages share the scope name %s", lang.ScopeName)
@@ -112,26 +131,27 @@ func NewHighlighter(languages []*Language, scopeData func(string)interface{}) (*
             h.languagesByFileExtension[v] = lang
         }
         if lang.FirstLineMatch != "" {
-            var errmsg *C.char
-            pattern := C.createPattern(&([]C.uchar(lang.FirstLineMatch))[0], C.size_t(len(lang.FirstLineMatch)), &errmsg)
-            if errmsg != nil {
-                err := errors.New(C.GoString(errmsg))
-                C.freeString(errmsg)
-                return nil, err
-            }
-            h.firstLineMatch[lang] = pattern
+            jobs = append(jobs, &patternJob{ lang: lang, kind: firstLinePattern, match: lang.FirstLineMatch })
         }
         for _, v := range lang.Patterns {
-            if err := h.createPatterns(lang, v); err != nil {
-                return nil, err
-            }
+            jobs = collectPatterns(jobs, lang, v)
         }
         for _, v := range lang.Repository {
-            if err := h.createPatterns(lang, v); err != nil {
-                return nil, err
+            jobs = collectPatterns(jobs, lang, v)
+        }
+    }
+    compilePatterns(jobs)
+    for _, job := range jobs {
+        if job.err != nil {
+            for _, job := range jobs {
+                C.freePattern(job.pattern)
             }
+            return nil, job.err
         }
     }
+    for _, job := range jobs {
+        h.finishPattern(job)
+    }
     for _, lang := range languages {
         // lang changes during the loop so we have to make a new binding here...
         l := lang
@@ -145,97 +165,176 @@ func NewHighlighter(languages []*Language, scopeData func(string)interface{}) (*
     }
     for _, lang := range languages {
         h.startState[lang] = C.createState()
+        h.describeState(h.startState[lang], lang, nil, "")
         h.addToState(h.startState[lang], lang, lang, lang.Patterns)
         for _, v := range h.deferredStates[lang] {
             h.addToState(v.state, lang, lang, v.patterns)
             v.patterns = nil
         }
     }
+    for s, rules := range h.stateRules {
+        C.setDispatch(s, C.compiledDispatch(C.uint64_t(StateKey(rules))))
+    }
     return h, nil
 }
 
-func (h *Highlighter) createPatterns(lang *Language, r *Rule) error {
+// identifies a state by the patterns of its match and begin rules, in order,
+// so a dispatch table compiled for it can be found again (see dispatch.c).
+func StateKey(rules []*Rule) uint64 {
+    h := fnv.New64a()
+    for _, rule := range rules {
+        if len(rule.Match) > 0 {
+            h.Write([]byte(rule.Match))
+        } else {
+            h.Write([]byte(rule.Begin))
+        }
+        h.Write([]byte{ 0 })
+    }
+    return h.Sum64()
+}
+
+// compiling the regexes is most of the work of creating a highlighter, and
+// each one is independent.  the rules are walked once to collect a job per
+// regex, the jobs are compiled in parallel, and then the results are wired
+// up in the order they were collected, so the highlighter comes out the same
+// as if everything had happened on one thread.
+type patternKind int
+const (
+    firstLinePattern patternKind = iota
+    matchPattern
+    beginPattern
+    endPattern
+    whilePattern
+)
+
+type patternJob struct {
+    lang *Language
+    rule *Rule
+    kind patternKind
+    match string
+    name string
+    innerName string
+    outerName string
+    captures map[string]Capture
+    backreferencing bool
+
+    pattern *C.pattern
+    err error
+}
+
+func collectPatterns(jobs []*patternJob, lang *Language, r *Rule) []*patternJob {
     if r.Disabled != 0 {
-        return nil
+        return jobs
     }
-    var err error
     if len(r.Match) > 0 {
-        if h.ruleMatch[r], err = h.createPattern(lang, r.Match, r.Name, "", "", r.Captures, nil, false); err != nil {
-            return err
-        }
+        jobs = collectPattern(jobs, &patternJob{ lang: lang, rule: r, kind: matchPattern, match: r.Match, name: r.Name }, r.Captures, nil)
     }
     if len(r.Begin) > 0 {
-        if h.ruleBegin[r], err = h.createPattern(lang, r.Begin, "", r.ContentName, r.Name, r.Captures, r.BeginCaptures, false); err != nil {
-            return err
-        }
+        jobs = collectPattern(jobs, &patternJob{ lang: lang, rule: r, kind: beginPattern, match: r.Begin, innerName: r.ContentName, outerName: r.Name }, r.Captures, r.BeginCaptures)
     }
     if len(r.End) > 0 {
-        if h.ruleEnd[r], err = h.createPattern(lang, r.End, "", r.ContentName, r.Name, r.Captures, r.EndCaptures, true); err != nil {
-            return err
-        }
+        jobs = collectPattern(jobs, &patternJob{ lang: lang, rule: r, kind: endPattern, match: r.End, innerName: r.ContentName, outerName: r.Name, backreferencing: true }, r.Captures, r.EndCaptures)
     }
     if len(r.While) > 0 {
-        if h.ruleWhile[r], err = h.createPattern(lang, r.While, "", r.ContentName, r.Name, r.Captures, r.WhileCaptures, true); err != nil {
-            return err
-        }
+        jobs = collectPattern(jobs, &patternJob{ lang: lang, rule: r, kind: whilePattern, match: r.While, innerName: r.ContentName, outerName: r.Name, backreferencing: true }, r.Captures, r.WhileCaptures)
     }
     for _, v := range r.Patterns {
-        if err := h.createPatterns(lang, v); err != nil {
-            return err
-        }
+        jobs = collectPatterns(jobs, lang, v)
     }
     for _, v := range r.Repository {
-        if err := h.createPatterns(lang, v); err != nil {
-            return err
+        jobs = collectPatterns(jobs, lang, v)
+    }
+    return jobs
+}
+
+func collectPattern(jobs []*patternJob, job *patternJob, generalCaptures map[string]Capture, specificCaptures map[string]Capture) []*patternJob {
+    job.captures = map[string]Capture{}
+    for k, v := range generalCaptures { job.captures[k] = v }
+    for k, v := range specificCaptures { job.captures[k] = v }
+    jobs = append(jobs, job)
+    for _, v := range job.captures {
+        for _, p := range v.Patterns {
+            jobs = collectPatterns(jobs, job.lang, p)
+        }
+        for _, p := range v.Repository {
+            jobs = collectPatterns(jobs, job.lang, p)
         }
     }
-    return nil
+    return jobs
+}
+
+// onig_new() is safe to call from several threads once onig_initialize() has
+// run, as long as each call compiles its own regex.
+func compilePatterns(jobs []*patternJob) {
+    next := int64(-1)
+    var wg sync.WaitGroup
+    for i := 0; i < runtime.NumCPU(); i++ {
+        wg.Add(1)
+        go func () {
+            defer wg.Done()
+            for {
+                i := atomic.AddInt64(&next, 1)
+                if i >= int64(len(jobs)) {
+                    return
+                }
+                jobs[i].compile()
+            }
+        }()
+    }
+    wg.Wait()
 }
 
-func (h *Highlighter) createPattern(lang *Language, match string, name string, innerName string, outerName string, generalCaptures map[string]Capture, specificCaptures map[string]Capture, backreferencing bool) (*C.pattern, error) {
+func (job *patternJob) compile() {
     var errmsg *C.char
-    var pattern *C.pattern
-    if backreferencing {
-        pattern = C.createBackreferencingPattern(&([]C.uchar(match))[0], C.size_t(len(match)), &errmsg)
+    if job.backreferencing {
+        job.pattern = C.createBackreferencingPattern(&([]C.uchar(job.match))[0], C.size_t(len(job.match)), &errmsg)
     } else {
-        pattern = C.createPattern(&([]C.uchar(match))[0], C.size_t(len(match)), &errmsg)
+        job.pattern = C.createPattern(&([]C.uchar(job.match))[0], C.size_t(len(job.match)), &errmsg)
     }
     if errmsg != nil {
-        err := errors.New(C.GoString(errmsg))
+        job.err = errors.New(C.GoString(errmsg))
         C.freeString(errmsg)
-        return nil, err
-    }
-    if len(name) > 0 {
-        C.setCaptureScope(pattern, &([]C.uchar("0"))[0], 1, C.int(h.getScopeId(name)))
-    }
-    if len(innerName) > 0 {
-        C.setInnerScope(pattern, C.int(h.getScopeId(innerName)))
-    }
-    if len(outerName) > 0 {
-        C.setOuterScope(pattern, C.int(h.getScopeId(outerName)))
     }
-    captures := map[string]Capture{}
-    for k, v := range generalCaptures { captures[k] = v }
-    for k, v := range specificCaptures { captures[k] = v }
-    for k, v := range captures {
+}
+
+// assigns scopes and capture states to a compiled pattern and records it.
+// scope ids are handed out here, on one thread, in the order the jobs were
+// collected.
+func (h *Highlighter) finishPattern(job *patternJob) {
+    pattern := job.pattern
+    switch job.kind {
+    case firstLinePattern:
+        h.firstLineMatch[job.lang] = pattern
+        return
+    case matchPattern:
+        h.ruleMatch[job.rule] = pattern
+    case beginPattern:
+        h.ruleBegin[job.rule] = pattern
+    case endPattern:
+        h.ruleEnd[job.rule] = pattern
+    case whilePattern:
+        h.ruleWhile[job.rule] = pattern
+    }
+    if len(job.name) > 0 {
+        C.setCaptureScope(pattern, &([]C.uchar("0"))[0], 1, C.int(h.getScopeId(job.name)))
+    }
+    if len(job.innerName) > 0 {
+        C.setInnerScope(pattern, C.int(h.getScopeId(job.innerName)))
+    }
+    if len(job.outerName) > 0 {
+        C.setOuterScope(pattern, C.int(h.getScopeId(job.outerName)))
+    }
+    for k, v := range job.captures {
         if len(v.Name) > 0 {
             C.setCaptureScope(pattern, &([]C.uchar(k))[0], C.size_t(len(k)), C.int(h.getScopeId(v.Name)))
         }
-        for _, p := range v.Patterns {
-            if err := h.createPatterns(lang, p); err != nil {
-                return nil, err
-            }
+        for range v.Patterns {
             state := C.createState()
+            h.describeState(state, job.lang, job.rule, k)
             C.setCaptureState(pattern, &([]C.uchar(k))[0], C.size_t(len(k)), state)
-            h.deferredStates[lang] = append(h.deferredStates[lang], deferredState{ state, v.Patterns })
-        }
-        for _, p := range v.Repository {
-            if err := h.createPatterns(lang, p); err != nil {
-                return nil, err
-            }
+            h.deferredStates[job.lang] = append(h.deferredStates[job.lang], deferredState{ state, v.Patterns })
         }
     }
-    return pattern, nil
 }
 
 func (h *Highlighter) linkRepositories(r *Rule, outerRepoFunc func(string)*Rule) {
@@ -315,12 +414,15 @@ func (h *Highlighter) addToState(s *C.state, lang *Language, base *Language, rul
                 h.addToState(s, extlang, base, extlang.Patterns)
             }
         } else if h.ruleMatch[rule] != nil {
+            h.describeRuleInState(s, rule)
+            h.stateRules[s] = append(h.stateRules[s], rule)
             C.addMatch(s, h.ruleMatch[rule])
         } else if h.ruleBegin[rule] != nil {
             ruleState := h.ruleState[rule]
             if ruleState == nil {
                 ruleState = C.createState()
                 h.ruleState[rule] = ruleState
+                h.describeState(ruleState, lang, rule, "")
                 // fmt.Printf("[state %p for %v]\n", ruleState, rule)
                 if h.ruleWhile[rule] != nil {
                     C.setWhile(ruleState, h.ruleWhile[rule])
@@ -334,6 +436,8 @@ func (h *Highlighter) addToState(s *C.state, lang *Language, base *Language, rul
                 // base for the patterns this rule contains.
                 h.addToState(ruleState, lang, lang, rule.Patterns)
             }
+            h.describeRuleInState(s, rule)
+            h.stateRules[s] = append(h.stateRules[s], rule)
             C.addBegin(s, ruleState, h.ruleBegin[rule])
         } else if len(rule.Patterns) > 0 {
             h.addToState(s, lang, base, rule.Patterns)
@@ -341,6 +445,48 @@ func (h *Highlighter) addToState(s *C.state, lang *Language, base *Language, rul
     }
 }
 
+// a state of the highlighter, for finding grammars which are slow to
+// highlight.  at each position in a state, every one of its rules' match or
+// begin patterns is tried at once with a regset.
+type StateDescription struct {
+    Language *Language
+    // the rule whose begin pattern (or capture, if Capture is set) enters
+    // this state.  nil for a language's start state.
+    Rule *Rule
+    Capture string
+    // the match and begin rules in the state, after includes are followed.
+    Rules []*Rule
+}
+
+// builds a highlighter for languages, and describes each of its states,
+// largest first.
+func DescribeStates(languages []*Language) ([]StateDescription, error) {
+    h, err := newHighlighter(languages, func (string) interface{} { return nil }, true)
+    if err != nil {
+        return nil, err
+    }
+    var descriptions []StateDescription
+    for _, d := range h.stateDescriptions {
+        descriptions = append(descriptions, *d)
+    }
+    sort.SliceStable(descriptions, func (i, j int) bool {
+        return len(descriptions[i].Rules) > len(descriptions[j].Rules)
+    })
+    return descriptions, nil
+}
+
+func (h *Highlighter) describeState(s *C.state, lang *Language, rule *Rule, capture string) {
+    if h.stateDescriptions != nil {
+        h.stateDescriptions[s] = &StateDescription{ Language: lang, Rule: rule, Capture: capture }
+    }
+}
+
+func (h *Highlighter) describeRuleInState(s *C.state, rule *Rule) {
+    if d := h.stateDescriptions[s]; d != nil {
+        d.Rules = append(d.Rules, rule)
+    }
+}
+
 func (h *Highlighter) getScopeId(scopeName string) int {
     id, ok := h.scopeId[scopeName]
     if ok {
@@ -421,8 +567,23 @@ func (h *Highlighter) Highlight(w Writer, fileData []byte, fileName string) erro
     // } else {
     //     fmt.Printf("%s has matching extension for %s\n", fileName, lang.ScopeName)
     }
+    return h.highlight(w, fileData, ucharData, lang)
+}
+
+// highlights fileData as lang, which must be one of the languages the
+// highlighter was built with, regardless of the file's name.
+func (h *Highlighter) HighlightLanguage(w Writer, fileData []byte, lang *Language) error {
+    if len(fileData) == 0 {
+        return nil
+    }
+    return h.highlight(w, fileData, []C.uchar(string(fileData)), lang)
+}
+
+func (h *Highlighter) highlight(w Writer, fileData []byte, ucharData []C.uchar, lang *Language) error {
     r := C.createRenderer(&ucharData[0], C.size_t(len(ucharData)), h.startState[lang])
     defer C.freeRenderer(r)
+    // the renderer holds on to ucharData, but the collector can't see that.
+    defer runtime.KeepAlive(ucharData)
     line := C.line{}
     defer C.freeLine(line)
     for C.renderNextLine(r, &line) {
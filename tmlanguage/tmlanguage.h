@@ -5,6 +5,7 @@
 #define tmlanguage_h
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 void initialize(void);
@@ -43,6 +44,20 @@ void setEnd(state *s, pattern *end, bool applyLast);
 void setWhile(state *s, pattern *while_);
 void freeState(state *s);
 
+// a state's dispatch table has a bitmask for each ascii byte, of the state's
+// match and begin patterns (in the order they were added) which can start a
+// match with that byte.  at ascii positions, only those patterns are tried,
+// and positions without any are skipped.  tables are compiled ahead of time
+// for the states of common grammars (see dispatch.c), and looked up by a hash
+// of the state's patterns, so they're only used with the grammars they were
+// compiled from.
+typedef struct dispatch {
+    uint64_t candidates[128];
+} dispatch;
+void setDispatch(state *s, const dispatch *d);
+// returns null if no table was compiled for key.
+const dispatch *compiledDispatch(uint64_t key);
+
 renderer *createRenderer(const unsigned char *bytes, size_t len, state *startState);
 void freeRenderer(renderer *r);
 
@@ -0,0 +1,324 @@
+package main
+
+import (
+    "archive/zip"
+    "bufio"
+    "encoding/json"
+    "fmt"
+    "io"
+    "log"
+    "os"
+    "os/exec"
+    "os/signal"
+    "path"
+    "runtime/debug"
+    "syscall"
+    "time"
+)
+
+// syntax highlighting runs through oniguruma, which can crash or get stuck on
+// a pathological regex.  to keep that from taking down the whole server, files
+// are rendered by worker processes (the dezip binary started with this
+// argument).  jobs and results are sent as json over the worker's stdin and
+// stdout.
+const renderWorkerCommand = "render-worker"
+
+// a worker is killed if rendering a single file uses more than this much cpu
+// time...
+const renderJobCPUTimeLimit = 60 * time.Second
+
+// ...or takes longer than this in wall clock time (e.g. if it's stuck waiting
+// on a swapping machine).
+const renderJobTimeLimit = 3 * time.Minute
+
+// the address space available to each worker process.  this needs to be a few
+// times larger than textFileSizeLimit, since rendering can hold several copies
+// of a file at once.
+const renderWorkerMemoryLimit = 4_000_000_000 // 4 GB
+
+// how many times to try rendering a file before giving up on highlighting it.
+// each attempt after the first uses a freshly started worker, and the reduced
+// grammars.
+const renderJobAttempts = 2
+
+// the number of zip files each worker keeps open.  renderers usually stick to
+// one archive at a time, but priority requests can bounce them between the
+// archives being rendered.
+const renderWorkerOpenZipLimit = activeArchiveLimit
+
+type renderJob struct {
+    // the temporary zip file holding the archive contents.
+    ZipFileName string
+    // the name of the entry to render within the zip file.
+    EntryName string
+    // the results of analysis from the download step, which the page writers
+    // need.
+    Lines int
+    MaximumLineLength int
+
+    ArchiveURL string
+    OutputFileName string
+    ContentType contentType
+    // highlight with the reduced grammars, even if the file could use the
+    // full ones.
+    ReducedFidelity bool
+
+    // for fuzz-grammars: instead of rendering a file, highlight FuzzInput with
+    // the grammar for FuzzScope (see fuzz.go).
+    FuzzScope string
+    FuzzInput []byte
+}
+
+type renderJobResult struct {
+    // empty on success.  worker crashes are reported separately -- this is
+    // just for ordinary errors like failing to create the output file.
+    Error string
+
+    // for fuzz jobs, how long highlighting took and the scope transitions it
+    // reached.
+    Elapsed time.Duration
+    Features []string
+}
+
+// -- parent side
+
+type renderWorker struct {
+    cmd *exec.Cmd
+    jobs *json.Encoder
+    results *json.Decoder
+}
+
+func (w *renderWorker) start() error {
+    executable, err := os.Executable()
+    if err != nil {
+        return err
+    }
+    cmd := exec.Command(executable, renderWorkerCommand)
+    cmd.Stderr = os.Stderr
+    stdin, err := cmd.StdinPipe()
+    if err != nil {
+        return err
+    }
+    stdout, err := cmd.StdoutPipe()
+    if err != nil {
+        return err
+    }
+    if err := cmd.Start(); err != nil {
+        return err
+    }
+    w.cmd = cmd
+    w.jobs = json.NewEncoder(stdin)
+    w.results = json.NewDecoder(stdout)
+    // the worker sends an empty result once its grammars are loaded.
+    var ready renderJobResult
+    if err := w.results.Decode(&ready); err != nil {
+        w.stop()
+        return fmt.Errorf("render worker failed to start: %v", err)
+    }
+    if len(ready.Error) > 0 {
+        w.stop()
+        return fmt.Errorf("render worker failed to start: %s", ready.Error)
+    }
+    return nil
+}
+
+func (w *renderWorker) stop() {
+    if w.cmd == nil {
+        return
+    }
+    w.cmd.Process.Kill()
+    w.cmd.Wait()
+    w.cmd = nil
+}
+
+// run sends a job to the worker, starting it if necessary.  a non-nil error
+// means the worker itself failed (it crashed, was killed for exceeding a
+// limit, or timed out) and has been stopped.
+func (w *renderWorker) run(job renderJob) (renderJobResult, error) {
+    return w.runWithTimeLimit(job, renderJobTimeLimit)
+}
+
+func (w *renderWorker) runWithTimeLimit(job renderJob, timeLimit time.Duration) (renderJobResult, error) {
+    if w.cmd == nil {
+        if err := w.start(); err != nil {
+            return renderJobResult{}, err
+        }
+    }
+    if err := w.jobs.Encode(job); err != nil {
+        w.stop()
+        return renderJobResult{}, err
+    }
+    var result renderJobResult
+    done := make(chan error, 1)
+    go func () {
+        done <- w.results.Decode(&result)
+    }()
+    select {
+    case err := <-done:
+        if err != nil {
+            w.stop()
+            return renderJobResult{}, fmt.Errorf("render worker exited: %v", err)
+        }
+        return result, nil
+    case <-time.After(timeLimit):
+        // killing the worker closes its stdout, which unblocks the decoder.
+        w.cmd.Process.Kill()
+        <-done
+        w.stop()
+        return renderJobResult{}, fmt.Errorf("render worker timed out after %v", timeLimit)
+    }
+}
+
+// -- worker side
+
+func renderWorkerMain() {
+    log.SetPrefix(fmt.Sprintf("[render worker %d] ", os.Getpid()))
+    results := json.NewEncoder(os.Stdout)
+    jobs := json.NewDecoder(bufio.NewReader(os.Stdin))
+
+    // limit the memory available to this process.  oniguruma reports
+    // allocation failures as errors, and the go runtime crashes, which the
+    // parent process will notice.
+    var limit syscall.Rlimit
+    if err := syscall.Getrlimit(syscall.RLIMIT_AS, &limit); err == nil {
+        if limit.Max > renderWorkerMemoryLimit {
+            limit.Cur = renderWorkerMemoryLimit
+            if err := syscall.Setrlimit(syscall.RLIMIT_AS, &limit); err != nil {
+                log.Print("unable to limit memory: ", err)
+            }
+        }
+    }
+    // the cpu limit is enforced with SIGXCPU, which the go runtime ignores by
+    // default.
+    cpuLimitExceeded := make(chan os.Signal, 1)
+    signal.Notify(cpuLimitExceeded, syscall.SIGXCPU)
+    go func () {
+        <-cpuLimitExceeded
+        log.Print("exceeded cpu time limit of ", renderJobCPUTimeLimit)
+        os.Exit(2)
+    }()
+
+    hs, err := newHighlighters(syntaxDefinitionPaths())
+    if err != nil {
+        results.Encode(renderJobResult{ Error: err.Error() })
+        os.Exit(1)
+    }
+    if err := results.Encode(renderJobResult{}); err != nil {
+        log.Fatal(err)
+    }
+
+    zips := &renderWorkerZips{ byName: map[string]*renderWorkerZip{} }
+    var fuzzing *fuzzHighlighter
+    for {
+        var job renderJob
+        if err := jobs.Decode(&job); err == io.EOF {
+            return
+        } else if err != nil {
+            log.Fatal(err)
+        }
+        limitCPUTime(renderJobCPUTimeLimit)
+        var result renderJobResult
+        if len(job.FuzzScope) > 0 {
+            result = fuzzJobInWorker(&fuzzing, job)
+        } else if err := renderJobInWorker(hs, zips, job); err != nil {
+            result.Error = err.Error()
+        }
+        if err := results.Encode(result); err != nil {
+            log.Fatal(err)
+        }
+    }
+}
+
+// allow the process to use d more cpu time than it's used so far.
+func limitCPUTime(d time.Duration) {
+    var usage syscall.Rusage
+    if err := syscall.Getrusage(syscall.RUSAGE_SELF, &usage); err != nil {
+        log.Print("unable to limit cpu time: ", err)
+        return
+    }
+    used := time.Duration(usage.Utime.Nano() + usage.Stime.Nano())
+    var limit syscall.Rlimit
+    if err := syscall.Getrlimit(syscall.RLIMIT_CPU, &limit); err != nil {
+        log.Print("unable to limit cpu time: ", err)
+        return
+    }
+    // the limit has a resolution of one second; round up.
+    limit.Cur = uint64((used + d + time.Second - 1) / time.Second)
+    if limit.Cur > limit.Max {
+        limit.Cur = limit.Max
+    }
+    if err := syscall.Setrlimit(syscall.RLIMIT_CPU, &limit); err != nil {
+        log.Print("unable to limit cpu time: ", err)
+    }
+}
+
+func renderJobInWorker(hs *highlighters, zips *renderWorkerZips, job renderJob) (err error) {
+    defer func () {
+        if r := recover(); r != nil {
+            err = fmt.Errorf("panic during render: %v\n%v", r, string(debug.Stack()))
+        }
+    }()
+    file, err := zips.open(job.ZipFileName, job.EntryName)
+    if err != nil {
+        return err
+    }
+    entry := &archiveDirectoryEntry{
+        file: file,
+        modified: file.Modified,
+        lines: job.Lines,
+        maximumLineLength: job.MaximumLineLength,
+    }
+    return renderPage(job.OutputFileName, job.ArchiveURL, entry, job.ContentType, hs, job.ReducedFidelity)
+}
+
+type renderWorkerZip struct {
+    reader *zip.ReadCloser
+    files map[string]*zip.File
+    lastUsed time.Time
+}
+
+type renderWorkerZips struct {
+    byName map[string]*renderWorkerZip
+}
+
+func (zs *renderWorkerZips) open(zipFileName string, entryName string) (*zip.File, error) {
+    // zip files are deleted once their archive finishes rendering.  close any
+    // that have gone away so the disk space can be reclaimed.
+    for name, z := range zs.byName {
+        if name == zipFileName {
+            continue
+        }
+        if _, err := os.Stat(name); err != nil {
+            z.reader.Close()
+            delete(zs.byName, name)
+        }
+    }
+    z := zs.byName[zipFileName]
+    if z == nil {
+        if len(zs.byName) >= renderWorkerOpenZipLimit {
+            var oldest string
+            for name, v := range zs.byName {
+                if oldest == "" || v.lastUsed.Before(zs.byName[oldest].lastUsed) {
+                    oldest = name
+                }
+            }
+            zs.byName[oldest].reader.Close()
+            delete(zs.byName, oldest)
+        }
+        rc, err := zip.OpenReader(zipFileName)
+        if err != nil {
+            return nil, err
+        }
+        z = &renderWorkerZip{ reader: rc, files: make(map[string]*zip.File, len(rc.File)) }
+        for _, f := range rc.File {
+            z.files[f.Name] = f
+        }
+        zs.byName[zipFileName] = z
+    }
+    z.lastUsed = time.Now()
+    file := z.files[entryName]
+    if file == nil {
+        return nil, fmt.Errorf("no entry named %s in %s", entryName, path.Base(zipFileName))
+    }
+    return file, nil
+}